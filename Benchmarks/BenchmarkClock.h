@@ -0,0 +1,13 @@
+#pragma once
+#include <chrono>
+
+class BenchmarkClock                                                            // Wall clock stopwatch started on construction
+{
+private:
+	std::chrono::steady_clock::time_point _start = std::chrono::steady_clock::now();
+
+public:
+	double seconds() const {                                                    // Get seconds since construction
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+	}
+};
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "ConcurrentArray/ConcurrentArray.h"
+#include "DynamicArray/DynamicArray.h"
+#include "BenchmarkClock.h"
+
+// N writers append while R readers keep reading published elements, on one ConcurrentArray versus one mutex-guarded DynamicArray.
+// Reports appends/sec and reads/sec over the time the writers run.
+// Usage: ConcurrentArrayBenchmark [total items] [readers]
+
+struct Result
+{
+	double Appends;
+	double Reads;
+};
+
+template<class Append, class Read>
+static Result run(const size_t& writerCount, const size_t& readerCount, const size_t& itemsPerWriter, Append&& append, Read&& read) {
+	std::atomic<bool> done = false;
+	std::atomic<uint64_t> reads = 0;
+	std::vector<std::thread> readers;
+	std::vector<std::thread> writers;
+
+	for (size_t r = 0; r < readerCount; r++)
+		readers.emplace_back([&, r]() {
+			uint64_t count = 0;
+			uint64_t sum = 0;
+			size_t seed = r + 1;
+			while (!done.load(std::memory_order_relaxed)) {
+				seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+				sum += read(seed >> 16);
+				count++;
+			}
+			reads.fetch_add(count, std::memory_order_relaxed);
+			if (sum == 42)                                                     // Keep the reads observable
+				std::printf(" ");
+		});
+
+	BenchmarkClock clock;
+	for (size_t w = 0; w < writerCount; w++)
+		writers.emplace_back([&append, itemsPerWriter]() {
+			for (size_t i = 0; i < itemsPerWriter; i++)
+				append(i);
+		});
+	for (std::thread& writer : writers)
+		writer.join();
+
+	double seconds = clock.seconds();
+	done.store(true, std::memory_order_relaxed);
+	for (std::thread& reader : readers)
+		reader.join();
+
+	return { writerCount * itemsPerWriter / seconds, reads.load() / seconds };
+}
+
+int main(int argc, char** argv) {
+	size_t items = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+	size_t readerCount = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2;
+
+	std::printf("%-8s %-8s %16s %16s %16s %16s\n", "writers", "readers", "concurrent app/s", "concurrent rd/s", "mutex app/s", "mutex rd/s");
+	for (size_t writerCount : { 1, 2, 4, 8, 16 }) {
+		size_t itemsPerWriter = items / writerCount;
+
+		Result concurrent;
+		{
+			ConcurrentArray<uint64_t> array;
+			concurrent = run(writerCount, readerCount, itemsPerWriter,
+				[&array](size_t i) { array.push_back(i); },
+				[&array](size_t random) -> uint64_t {
+					size_t size = array.size();
+					if (size == 0)
+						return 0;
+
+					size_t index = random % size;
+					return array.is_published(index) ? array[index] : 0;
+				});
+		}
+
+		Result locked;
+		{
+			DynamicArray<uint64_t> array;
+			std::mutex mutex;
+			locked = run(writerCount, readerCount, itemsPerWriter,
+				[&array, &mutex](size_t i) {
+					std::lock_guard<std::mutex> guard(mutex);
+					array.push_back(i);
+				},
+				[&array, &mutex](size_t random) -> uint64_t {
+					std::lock_guard<std::mutex> guard(mutex);
+					return array.empty() ? 0 : array[random % array.size()];
+				});
+		}
+
+		std::printf("%-8zu %-8zu %16.0f %16.0f %16.0f %16.0f\n", writerCount, readerCount, concurrent.Appends, concurrent.Reads, locked.Appends, locked.Reads);
+	}
+	return 0;
+}
\ No newline at end of file
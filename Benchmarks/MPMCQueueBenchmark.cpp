@@ -0,0 +1,51 @@
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "MPMCQueue/MPMCQueue.h"
+#include "BenchmarkClock.h"
+
+// ops/sec (one enqueue + one dequeue per item) for N producers and N consumers sharing one queue.
+// Usage: MPMCQueueBenchmark [items per producer]
+
+static double run(const size_t& threadsPerSide, const size_t& itemsPerProducer) {
+	MPMCQueue<uint64_t> queue(1024);
+	std::atomic<bool> start = false;
+	std::vector<std::thread> threads;
+
+	for (size_t p = 0; p < threadsPerSide; p++)
+		threads.emplace_back([&]() {
+			while (!start.load(std::memory_order_acquire));
+			for (uint64_t i = 0; i < itemsPerProducer; i++)
+				queue.enqueue(i);
+		});
+
+	for (size_t c = 0; c < threadsPerSide; c++)
+		threads.emplace_back([&]() {
+			while (!start.load(std::memory_order_acquire));
+			uint64_t value;
+			for (uint64_t i = 0; i < itemsPerProducer; i++)
+				queue.dequeue(value);
+		});
+
+	BenchmarkClock clock;
+	start.store(true, std::memory_order_release);
+	for (std::thread& thread : threads)
+		thread.join();
+
+	return 2.0 * threadsPerSide * itemsPerProducer / clock.seconds();
+}
+
+int main(int argc, char** argv) {
+	size_t items = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+	std::printf("%-10s %15s\n", "threads", "ops/sec");
+	for (size_t threadsPerSide : { 1, 2, 4, 8, 16 }) {
+		double opsPerSecond = run(threadsPerSide, items / threadsPerSide);
+		char label[16];
+		std::snprintf(label, sizeof(label), "%zuP%zuC", threadsPerSide, threadsPerSide);
+		std::printf("%-10s %15.0f\n", label, opsPerSecond);
+	}
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include "RadixSorter/RadixSorter.h"
+#include "BenchmarkClock.h"
+
+// Milliseconds for RadixSorter (1 thread and hardware_concurrency threads) versus the standard sorts, on uint32_t,
+// uint64_t and key/value records, for several sizes and input distributions. Each time is the best of a few runs
+// on a fresh copy. Records are compared with std::stable_sort, since sort_by_key is stable.
+
+enum class Distribution
+{
+	Uniform,
+	FewUnique,
+	Sorted,
+	Reversed
+};
+
+struct Record                                                                   // 8 byte key, 8 byte payload
+{
+	uint64_t Key;
+	uint64_t Value;
+};
+
+static const char* name(const Distribution& distribution) {
+	switch (distribution) {
+	case Distribution::Uniform: return "uniform";
+	case Distribution::FewUnique: return "few-unique";
+	case Distribution::Sorted: return "sorted";
+	default: return "reversed";
+	}
+}
+
+static uint32_t key_of(const uint32_t& value) {
+	return value;
+}
+
+static uint64_t key_of(const uint64_t& value) {
+	return value;
+}
+
+static uint64_t key_of(const Record& record) {
+	return record.Key;
+}
+
+template<class Type>
+static Type make_value(const uint64_t& key, const size_t& index) {
+	if constexpr (std::is_same_v<Type, Record>)
+		return Record{ key, index };
+	else
+		return (Type)key;
+}
+
+template<class Type>
+static DynamicArray<Type> make_input(const size_t& size, const Distribution& distribution) {
+	std::mt19937_64 random(1);
+	DynamicArray<Type> array;
+	array.reserve(size);
+	for (size_t i = 0; i < size; i++)
+		array.push_back(make_value<Type>(distribution == Distribution::FewUnique ? random() % 16 : random(), i));
+
+	if (distribution == Distribution::Sorted)
+		std::sort(array.begin(), array.end(), [](const Type& left, const Type& right) { return key_of(left) < key_of(right); });
+	else if (distribution == Distribution::Reversed)
+		std::sort(array.begin(), array.end(), [](const Type& left, const Type& right) { return key_of(left) > key_of(right); });
+
+	return array;
+}
+
+template<class Type, class Sort>
+static double best_milliseconds(const DynamicArray<Type>& input, Sort&& sort) {
+	double best = 1e300;
+	for (int run = 0; run < 3; run++) {
+		DynamicArray<Type> array = input;
+		BenchmarkClock clock;
+		sort(array);
+		best = std::min(best, clock.seconds() * 1000.0);
+	}
+	return best;
+}
+
+template<class Type>
+static void run_table(const char* title, const size_t& threadCount) {
+	RadixSorter<Type> serial;
+	RadixSorter<Type> parallel(threadCount);
+	auto key = [](const Type& value) { return key_of(value); };
+	auto less = [](const Type& left, const Type& right) { return key_of(left) < key_of(right); };
+
+	std::printf("\n%s\n", title);
+	std::printf("%-12s %10s %12s %12s %12s\n", "input", "size", std::is_same_v<Type, Record> ? "stable_sort" : "std::sort", "radix", "radix MT");
+	for (Distribution distribution : { Distribution::Uniform, Distribution::FewUnique, Distribution::Sorted, Distribution::Reversed })
+		for (size_t size : { 1000, 100000, 1000000, 10000000 }) {
+			DynamicArray<Type> input = make_input<Type>(size, distribution);
+
+			double standard = best_milliseconds(input, [&less](DynamicArray<Type>& array) {
+				if constexpr (std::is_same_v<Type, Record>)
+					std::stable_sort(array.begin(), array.end(), less);
+				else
+					std::sort(array.begin(), array.end(), less);
+			});
+			double radix = best_milliseconds(input, [&serial, &key](DynamicArray<Type>& array) { serial.sort_by_key(array, key); });
+			double radixParallel = best_milliseconds(input, [&parallel, &key](DynamicArray<Type>& array) { parallel.sort_by_key(array, key); });
+
+			std::printf("%-12s %10zu %12.3f %12.3f %12.3f\n", name(distribution), size, standard, radix, radixParallel);
+		}
+}
+
+int main() {
+	size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+	run_table<uint32_t>("uint32_t", threadCount);
+	run_table<uint64_t>("uint64_t", threadCount);
+	run_table<Record>("Record (uint64_t key, uint64_t value)", threadCount);
+	return 0;
+}
\ No newline at end of file
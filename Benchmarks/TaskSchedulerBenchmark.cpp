@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+#include "TaskScheduler/TaskGroup.h"
+#include "BenchmarkClock.h"
+
+// Seconds for recursive fib and parallel quicksort as the worker count grows, speedup relative to 1 worker.
+// Usage: TaskSchedulerBenchmark [fib n] [sort size]
+
+static constexpr int FibCutoff = 20;                                            // Below this fib runs serially
+static constexpr size_t SortCutoff = 4096;                                      // Below this std::sort takes over
+
+static uint64_t serial_fib(const int& n) {
+	return n < 2 ? n : serial_fib(n - 1) + serial_fib(n - 2);
+}
+
+static uint64_t fib(TaskScheduler& scheduler, const int& n) {
+	if (n < FibCutoff)
+		return serial_fib(n);
+
+	uint64_t left = 0;
+	TaskGroup group(scheduler);
+	group.spawn([&]() { left = fib(scheduler, n - 1); });
+	uint64_t right = fib(scheduler, n - 2);
+	group.wait();
+	return left + right;
+}
+
+static void quicksort(TaskScheduler& scheduler, uint32_t* first, uint32_t* last) {
+	if ((size_t)(last - first) < SortCutoff) {
+		std::sort(first, last);
+		return;
+	}
+
+	uint32_t pivot = first[(last - first) / 2];
+	uint32_t* middle1 = std::partition(first, last, [pivot](uint32_t value) { return value < pivot; });
+	uint32_t* middle2 = std::partition(middle1, last, [pivot](uint32_t value) { return !(pivot < value); });
+
+	TaskGroup group(scheduler);
+	group.spawn([&]() { quicksort(scheduler, first, middle1); });
+	quicksort(scheduler, middle2, last);
+	group.wait();
+}
+
+int main(int argc, char** argv) {
+	int fibN = argc > 1 ? std::atoi(argv[1]) : 42;
+	size_t sortSize = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 20000000;
+
+	std::vector<uint32_t> input(sortSize);
+	std::mt19937 random(1);
+	for (uint32_t& value : input)
+		value = random();
+
+	size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+	double fibBase = 0;
+	double sortBase = 0;
+
+	std::vector<size_t> threadCounts;                                           // Powers of two below maxThreads, then maxThreads itself
+	for (size_t threads = 1; threads < maxThreads; threads *= 2)
+		threadCounts.push_back(threads);
+	threadCounts.push_back(maxThreads);
+
+	std::printf("%-8s %12s %8s %12s %8s\n", "threads", "fib s", "speedup", "sort s", "speedup");
+	for (size_t threads : threadCounts) {
+		TaskScheduler scheduler(threads);
+
+		BenchmarkClock fibClock;
+		volatile uint64_t result = fib(scheduler, fibN);
+		(void)result;
+		double fibSeconds = fibClock.seconds();
+
+		std::vector<uint32_t> values = input;
+		BenchmarkClock sortClock;
+		quicksort(scheduler, values.data(), values.data() + values.size());
+		double sortSeconds = sortClock.seconds();
+
+		if (threads == 1) {
+			fibBase = fibSeconds;
+			sortBase = sortSeconds;
+		}
+		std::printf("%-8zu %12.3f %8.2f %12.3f %8.2f\n", threads, fibSeconds, fibBase / fibSeconds, sortSeconds, sortBase / sortSeconds);
+	}
+	return 0;
+}
\ No newline at end of file
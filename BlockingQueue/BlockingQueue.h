@@ -0,0 +1,275 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include "BlockingQueueWait.h"
+#include "BlockingQueueAwaiter.h"
+#include "../Queue/Queue.h"
+
+template<class Type>
+class BlockingQueue                                                             // Queue whose push waits while full and pop waits while empty, until close()
+{
+public:
+	using ValueType = Type;                                                     // Type for stored values
+	using PopAwaiter = BlockingQueueAwaiter<BlockingQueue<ValueType>>;          // Awaitable returned by pop()
+
+	static constexpr size_t SpinCount = 128;                                    // Polls of the wake word before a thread parks
+
+private:
+	friend PopAwaiter;                                                          // Awaiters call suspend_awaiter
+
+	class ScopedLock                                                            // Holds _lock until unlock() or the end of scope, also when an exception leaves it
+	{
+	private:
+		const BlockingQueue& _owner;                                            // Queue whose lock is held
+		bool _locked = true;                                                    // Still held
+
+	public:
+		ScopedLock(const BlockingQueue& owner)
+			:_owner(owner) {
+			_owner.lock();
+		}
+
+		ScopedLock(const ScopedLock&) = delete;
+		ScopedLock& operator=(const ScopedLock&) = delete;
+
+		~ScopedLock() {
+			if (_locked)
+				_owner.unlock();
+		}
+
+		void unlock() {                                                         // Release early
+			_owner.unlock();
+			_locked = false;
+		}
+	};
+
+	Queue<ValueType> _queue;                                                    // Stored components (guarded by _lock)
+	size_t _capacity = SIZE_MAX;                                                // Maximum number of stored components
+	bool _closed = false;                                                       // No more pushes accepted (guarded by _lock)
+	PopAwaiter* _awaitersHead = nullptr;                                        // Suspended coroutines, served first (guarded by _lock)
+	PopAwaiter* _awaitersTail = nullptr;                                        // Last suspended coroutine (guarded by _lock)
+	mutable std::atomic_flag _lock;                                             // Spin lock around the short critical sections
+
+	alignas(64) std::atomic<uint32_t> _notEmpty = 0;                            // Wake word bumped after a push or close
+	std::atomic<uint32_t> _waitingConsumers = 0;                                // Threads parked on _notEmpty
+	alignas(64) std::atomic<uint32_t> _notFull = 0;                             // Wake word bumped after a pop or close
+	std::atomic<uint32_t> _waitingProducers = 0;                                // Threads parked on _notFull
+
+public:
+	// Constructors
+
+	BlockingQueue() = default;                                                  // Default Constructor (unbounded)
+
+	BlockingQueue(const size_t& capacity)                                       // Bounded Constructor, push waits while size() == capacity
+		:_capacity(capacity ? capacity : 1) { }
+
+	BlockingQueue(const BlockingQueue&) = delete;
+	BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+	~BlockingQueue() {                                                          // Destructor
+		close();
+	}
+
+public:
+	// Main functions (producers)
+
+	template<class... Args>
+	bool emplace(Args&&... args) {                                              // Construct object using arguments (Args) at the tail, wait while full. False if closed
+		while (true) {
+			uint32_t epoch = _notFull.load(std::memory_order_acquire);
+			ScopedLock guard(*this);
+
+			if (_closed)
+				return false;
+
+			if (_awaitersHead != nullptr) {                                     // Hand over directly to a suspended coroutine
+				PopAwaiter* awaiter = _awaitersHead;
+				awaiter->_result.emplace(std::forward<Args>(args)...);          // If this throws the awaiter stays linked
+				pop_awaiter();
+				guard.unlock();
+
+				awaiter->_handle.resume();                                      // Coroutine continues on this thread
+				return true;
+			}
+
+			if (_queue.size() < _capacity) {
+				_queue.enqueue(std::forward<Args>(args)...);
+				guard.unlock();
+
+				notify(_notEmpty, _waitingConsumers);
+				return true;
+			}
+
+			guard.unlock();
+			park(_notFull, epoch, _waitingProducers);
+		}
+	}
+
+	bool push(const ValueType& copyValue) {                                     // Add copy to the tail, wait while full. False if closed
+		return emplace(copyValue);
+	}
+
+	bool push(ValueType&& moveValue) {                                          // Add temporary to the tail, wait while full. False if closed
+		return emplace(std::move(moveValue));
+	}
+
+	void close() {                                                              // Reject further pushes, wake every waiter. Stored components can still be popped
+		ScopedLock guard(*this);
+		_closed = true;
+		PopAwaiter* awaiter = _awaitersHead;
+		_awaitersHead = _awaitersTail = nullptr;
+		guard.unlock();
+
+		_notEmpty.fetch_add(1, std::memory_order_seq_cst);
+		_notFull.fetch_add(1, std::memory_order_seq_cst);
+		BlockingQueueWait::wake_all(_notEmpty);
+		BlockingQueueWait::wake_all(_notFull);
+
+		while (awaiter != nullptr) {                                            // Resume suspended coroutines with an empty result
+			PopAwaiter* next = awaiter->_next;
+			awaiter->_handle.resume();
+			awaiter = next;
+		}
+	}
+
+public:
+	// Main functions (consumers)
+
+	bool try_pop(ValueType& out) {                                              // Move first component into out and remove it, if any
+		ScopedLock guard(*this);
+		bool popped = _queue.try_dequeue(out);
+		guard.unlock();
+
+		if (popped)
+			notify(_notFull, _waitingProducers);
+		return popped;
+	}
+
+	bool pop(ValueType& out) {                                                  // Move first component into out and remove it, wait while empty. False if closed and drained
+		while (true) {
+			uint32_t epoch = _notEmpty.load(std::memory_order_acquire);
+			if (try_pop(out))
+				return true;
+			if (closed())
+				return false;
+
+			park(_notEmpty, epoch, _waitingConsumers);
+		}
+	}
+
+	template<class Rep, class Period>
+	bool try_pop_for(ValueType& out, const std::chrono::duration<Rep, Period>& timeout) {    // Like pop, but give up after timeout
+		auto deadline = deadline_after(timeout);
+		while (true) {
+			uint32_t epoch = _notEmpty.load(std::memory_order_acquire);
+			if (try_pop(out))
+				return true;
+			if (closed())
+				return false;
+
+			auto remaining = deadline - std::chrono::steady_clock::now();
+			if (remaining <= remaining.zero())
+				return false;
+
+			park(_notEmpty, epoch, _waitingConsumers, std::chrono::duration_cast<std::chrono::nanoseconds>(remaining));
+		}
+	}
+
+	PopAwaiter pop() {                                                          // co_await q.pop() -> std::optional<ValueType>, empty if closed and drained
+		return PopAwaiter(*this);
+	}
+
+	const size_t size() const {                                                 // Get size
+		ScopedLock guard(*this);
+		return _queue.size();
+	}
+
+	bool empty() const {                                                        // Check if queue is empty
+		return size() == 0;
+	}
+
+	const size_t capacity() const {                                             // Get capacity
+		return _capacity;
+	}
+
+	bool closed() const {                                                       // Check if close() was called
+		ScopedLock guard(*this);
+		return _closed;
+	}
+
+private:
+	// Others
+
+	bool suspend_awaiter(PopAwaiter* awaiter) {                                 // Fill awaiter right away or link it for a later hand-off. True if it must suspend
+		ScopedLock guard(*this);
+		if (!_queue.empty()) {
+			awaiter->_result = _queue.pop();
+			guard.unlock();
+
+			notify(_notFull, _waitingProducers);
+			return false;
+		}
+
+		if (_closed)
+			return false;
+
+		awaiter->_next = nullptr;
+		if (_awaitersTail == nullptr)
+			_awaitersHead = awaiter;
+		else
+			_awaitersTail->_next = awaiter;
+		_awaitersTail = awaiter;
+
+		return true;
+	}
+
+	PopAwaiter* pop_awaiter() {                                                 // Unlink first suspended coroutine (lock held)
+		PopAwaiter* awaiter = _awaitersHead;
+		_awaitersHead = awaiter->_next;
+		if (_awaitersHead == nullptr)
+			_awaitersTail = nullptr;
+
+		return awaiter;
+	}
+
+	void notify(std::atomic<uint32_t>& word, std::atomic<uint32_t>& waiting) {  // Bump wake word, enter the kernel only if someone is parked
+		word.fetch_add(1, std::memory_order_seq_cst);
+		if (waiting.load(std::memory_order_seq_cst) != 0)
+			BlockingQueueWait::wake_one(word);
+	}
+
+	void park(std::atomic<uint32_t>& word, const uint32_t& epoch, std::atomic<uint32_t>& waiting,
+			const std::chrono::nanoseconds& timeout = std::chrono::nanoseconds::max()) {    // Spin briefly on word, then sleep until it changes (every call spins again)
+		for (size_t spins = 0; spins < SpinCount; spins++)
+			if (word.load(std::memory_order_acquire) != epoch)
+				return;
+
+		waiting.fetch_add(1, std::memory_order_seq_cst);
+		if (timeout == std::chrono::nanoseconds::max())
+			BlockingQueueWait::wait(word, epoch);
+		else
+			BlockingQueueWait::wait_for(word, epoch, timeout);
+		waiting.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	template<class Rep, class Period>
+	static std::chrono::steady_clock::time_point deadline_after(const std::chrono::duration<Rep, Period>& timeout) {    // now() + timeout, clamped to time_point::max() instead of overflowing
+		auto now = std::chrono::steady_clock::now();
+		auto limit = std::chrono::steady_clock::time_point::max() - now;
+		if (std::chrono::duration<double>(timeout) >= std::chrono::duration<double>(limit))
+			return std::chrono::steady_clock::time_point::max();
+
+		return now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+	}
+
+	void lock() const {
+		while (_lock.test_and_set(std::memory_order_acquire))
+			std::this_thread::yield();
+	}
+
+	void unlock() const {
+		_lock.clear(std::memory_order_release);
+	}
+};
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+#include <coroutine>
+#include <optional>
+
+template<class BlockingQueue>
+class BlockingQueueAwaiter                                                      // Awaitable returned by BlockingQueue::pop(), resumes with a value or empty when closed
+{
+public:
+	using ValueType = typename BlockingQueue::ValueType;
+
+private:
+	friend BlockingQueue;                                                       // Queue fills _result and links waiting awaiters
+
+	BlockingQueue& _queue;                                                      // Queue to pop from
+	std::optional<ValueType> _result;                                           // Value handed over by pop or by a producer
+	std::coroutine_handle<> _handle;                                            // Coroutine to resume on hand-off
+	BlockingQueueAwaiter* _next = nullptr;                                      // Reference to next waiting awaiter
+
+public:
+	BlockingQueueAwaiter(BlockingQueue& queue)
+		:_queue(queue) { }
+
+	bool await_ready() const noexcept {                                         // Always go through await_suspend, it decides under the queue lock
+		return false;
+	}
+
+	bool await_suspend(std::coroutine_handle<> handle) {                        // Suspend only if the queue is empty and open
+		_handle = handle;
+		return _queue.suspend_awaiter(this);
+	}
+
+	std::optional<ValueType> await_resume() {                                   // Get popped value (empty if the queue was closed)
+		return std::move(_result);
+	}
+};
\ No newline at end of file
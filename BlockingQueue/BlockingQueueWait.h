@@ -0,0 +1,78 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <ctime>
+#elif defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#pragma comment(lib, "Synchronization.lib")
+#endif
+
+struct BlockingQueueWait                                                        // Park/unpark threads on a 32-bit word (futex on Linux, WaitOnAddress on Windows)
+{
+public:
+	static void wait(std::atomic<uint32_t>& word, const uint32_t& old) {        // Sleep while word == old (may wake spuriously)
+#if defined(__linux__)
+		syscall(SYS_futex, address(word), FUTEX_WAIT_PRIVATE, old, nullptr, nullptr, 0);
+#elif defined(_WIN32)
+		uint32_t compare = old;
+		WaitOnAddress(address(word), &compare, sizeof(uint32_t), INFINITE);
+#else
+		word.wait(old, std::memory_order_acquire);
+#endif
+	}
+
+	static void wait_for(std::atomic<uint32_t>& word, const uint32_t& old, const std::chrono::nanoseconds& timeout) {    // Sleep while word == old, at most timeout
+		if (timeout <= std::chrono::nanoseconds::zero())
+			return;
+#if defined(__linux__)
+		timespec relative;
+		relative.tv_sec = (time_t)(timeout.count() / 1000000000);
+		relative.tv_nsec = (long)(timeout.count() % 1000000000);
+		syscall(SYS_futex, address(word), FUTEX_WAIT_PRIVATE, old, &relative, nullptr, 0);
+#elif defined(_WIN32)
+		uint32_t compare = old;
+		DWORD milliseconds = (DWORD)std::chrono::ceil<std::chrono::milliseconds>(timeout).count();
+		WaitOnAddress(address(word), &compare, sizeof(uint32_t), milliseconds);
+#else
+		auto deadline = std::chrono::steady_clock::now() + timeout;                   // No timed wait available, poll
+		while (word.load(std::memory_order_acquire) == old && std::chrono::steady_clock::now() < deadline)
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+#endif
+	}
+
+	static void wake_one(std::atomic<uint32_t>& word) {                         // Wake one thread sleeping on word
+#if defined(__linux__)
+		syscall(SYS_futex, address(word), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#elif defined(_WIN32)
+		WakeByAddressSingle(address(word));
+#else
+		word.notify_one();
+#endif
+	}
+
+	static void wake_all(std::atomic<uint32_t>& word) {                         // Wake every thread sleeping on word
+#if defined(__linux__)
+		syscall(SYS_futex, address(word), FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+#elif defined(_WIN32)
+		WakeByAddressAll(address(word));
+#else
+		word.notify_all();
+#endif
+	}
+
+private:
+	static uint32_t* address(std::atomic<uint32_t>& word) {                     // Lock-free atomic<uint32_t> has the layout of uint32_t
+		static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) && std::atomic<uint32_t>::is_always_lock_free);
+		return reinterpret_cast<uint32_t*>(&word);
+	}
+};
\ No newline at end of file
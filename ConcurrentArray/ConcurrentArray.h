@@ -0,0 +1,145 @@
+#pragma once
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <stdexcept>
+#include "ConcurrentArraySlot.h"
+
+template<class Type>
+class ConcurrentArray                                                           // Growable array with lock-free appends, elements never move once constructed
+{
+public:
+	using ValueType = Type;                                                     // Type for stored values
+	using Slot = ConcurrentArraySlot<ConcurrentArray<ValueType>>;               // Slot type
+
+	static constexpr size_t FirstSegmentSize = 32;                              // Slots in segment 0, segment k holds FirstSegmentSize << k (power of 2)
+	static constexpr size_t MaxSegments = 48;                                   // Enough segments to address any realistic memory
+
+private:
+	std::atomic<size_t> _size = 0;                                              // Slots reserved by writers (published or not)
+	std::atomic<Slot*> _segments[MaxSegments] = {};                             // Segment table, entries are set once and never replaced
+
+public:
+	// Constructors
+
+	ConcurrentArray() = default;                                                // Default Constructor
+
+	ConcurrentArray(const ConcurrentArray&) = delete;
+	ConcurrentArray& operator=(const ConcurrentArray&) = delete;
+
+	~ConcurrentArray() {                                                        // Destructor (no other thread may operate)
+		for (size_t k = 0; k < MaxSegments; k++) {
+			Slot* segment = _segments[k].load(std::memory_order_relaxed);
+			if (segment == nullptr)
+				continue;
+
+			for (size_t i = 0; i < segment_size(k); i++)
+				if (segment[i].Ready.load(std::memory_order_relaxed))
+					std::destroy_at(segment[i].value());
+			delete[] segment;
+		}
+	}
+
+public:
+	// Main functions (any thread)
+
+	template<class... Args>
+	size_t emplace_back(Args&&... args) {                                       // Construct object using arguments (Args) in a new slot, return its index
+		size_t index = _size.fetch_add(1, std::memory_order_relaxed);
+		construct(index, std::forward<Args>(args)...);
+		return index;
+	}
+
+	size_t push_back(const ValueType& copyValue) {                              // Append copy, return its index
+		return emplace_back(copyValue);
+	}
+
+	size_t push_back(ValueType&& moveValue) {                                   // Append temporary, return its index
+		return emplace_back(std::move(moveValue));
+	}
+
+	template<class... Args>
+	size_t grow_by(const size_t& count, Args&&... args) {                       // Append count objects constructed with arguments (Args), return first index
+		size_t first = _size.fetch_add(count, std::memory_order_relaxed);
+		for (size_t i = first; i < first + count; i++)
+			construct(i, args...);
+
+		return first;
+	}
+
+	bool is_published(const size_t& index) const {                             // Check if the value at index is constructed and visible
+		if (index >= _size.load(std::memory_order_acquire))
+			return false;
+
+		Slot* segment = _segments[segment_index(index)].load(std::memory_order_acquire);
+		return segment != nullptr && segment[segment_offset(index)].Ready.load(std::memory_order_acquire);
+	}
+
+	const ValueType& at(const size_t& index) const {                            // Acces published object at index with check (read only)
+		if (!is_published(index))
+			throw std::out_of_range("Invalid Index...");
+
+		return (*this)[index];
+	}
+
+	ValueType& at(const size_t& index) {                                        // Acces published object at index with check
+		if (!is_published(index))
+			throw std::out_of_range("Invalid Index...");
+
+		return (*this)[index];
+	}
+
+	const size_t size() const {                                                 // Get number of reserved slots (the last ones may not be published yet)
+		return _size.load(std::memory_order_acquire);
+	}
+
+	bool empty() const {                                                        // Check if array is empty
+		return size() == 0;
+	}
+
+public:
+	// Operators
+
+	const ValueType& operator[](const size_t& index) const {                    // Acces published object at index (read only)
+		return *_segments[segment_index(index)].load(std::memory_order_acquire)[segment_offset(index)].value();
+	}
+
+	ValueType& operator[](const size_t& index) {                                // Acces published object at index
+		return *_segments[segment_index(index)].load(std::memory_order_acquire)[segment_offset(index)].value();
+	}
+
+private:
+	// Others
+
+	template<class... Args>
+	void construct(const size_t& index, Args&&... args) {                       // Construct value in its slot, then publish it
+		Slot& slot = ensure_segment(segment_index(index))[segment_offset(index)];
+		std::construct_at(slot.value(), std::forward<Args>(args)...);
+		slot.Ready.store(true, std::memory_order_release);
+	}
+
+	Slot* ensure_segment(const size_t& k) {                                     // Get segment k, the first writer to need it allocates it
+		Slot* segment = _segments[k].load(std::memory_order_acquire);
+		if (segment != nullptr)
+			return segment;
+
+		Slot* newSegment = new Slot[segment_size(k)];
+		if (_segments[k].compare_exchange_strong(segment, newSegment, std::memory_order_acq_rel, std::memory_order_acquire))
+			return newSegment;
+
+		delete[] newSegment;                                                    // Another writer won, segment holds its pointer
+		return segment;
+	}
+
+	static size_t segment_index(const size_t& index) {                         // Segment k covers [FirstSegmentSize * (2^k - 1), FirstSegmentSize * (2^(k+1) - 1))
+		return std::bit_width(index / FirstSegmentSize + 1) - 1;
+	}
+
+	static size_t segment_offset(const size_t& index) {                        // Position of index inside its segment
+		return index - FirstSegmentSize * ((size_t(1) << segment_index(index)) - 1);
+	}
+
+	static size_t segment_size(const size_t& k) {                              // Number of slots in segment k
+		return FirstSegmentSize << k;
+	}
+};
\ No newline at end of file
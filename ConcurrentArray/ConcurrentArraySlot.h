@@ -0,0 +1,20 @@
+#pragma once
+#include <atomic>
+
+template<class ConcurrentArray>
+struct ConcurrentArraySlot                                                       // Struct that holds raw storage for one value and its publication flag
+{
+public:
+	using ValueType = typename ConcurrentArray::ValueType;
+
+	std::atomic<bool> Ready = false;                                             // Value constructed and visible to readers
+	alignas(ValueType) unsigned char Storage[sizeof(ValueType)];                 // Raw memory for data
+
+	ValueType* value() {                                                         // Access data stored in this slot
+		return reinterpret_cast<ValueType*>(Storage);
+	}
+
+	const ValueType* value() const {                                             // Access data stored in this slot (read only)
+		return reinterpret_cast<const ValueType*>(Storage);
+	}
+};
\ No newline at end of file
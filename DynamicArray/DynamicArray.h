@@ -1,4 +1,7 @@
 #pragma once
+#include <memory>
+#include <span>
+#include <type_traits>
 #include "DynamicArrayIterator.h"
 
 template<class Type>
@@ -6,7 +9,8 @@ class DynamicArray
 {
 public:
 	using ValueType = Type;                                                          // Type for stored values
-	using Iterator = typename DynamicArrayIterator<DynamicArray<ValueType>>;         // Iterator type
+	using Iterator = DynamicArrayIterator<DynamicArray<ValueType>>;                  // Iterator type
+	using ConstIterator = DynamicArrayConstIterator<DynamicArray<ValueType>>;            // Const Iterator type
 
 private:
 	size_t _size = 0;                                                                // Number of components held by this
@@ -16,40 +20,40 @@ private:
 public:
 	// Constructors
 
-	DynamicArray() = default;                                                        // Default Constructor
+	constexpr DynamicArray() = default;                                              // Default Constructor
 	
 	template<class... Args>
-	DynamicArray(const size_t& newCapacity, Args&&... args) {                        // Emplace type Constructor
+	constexpr DynamicArray(const size_t& newCapacity, Args&&... args) {              // Emplace type Constructor
 		realloc(newCapacity, std::forward<Args>(args)...);
 	}
 
-	DynamicArray(const size_t& newCapacity, const ValueType& copyValue) {            // Reference type Constructor
+	constexpr DynamicArray(const size_t& newCapacity, const ValueType& copyValue) {  // Reference type Constructor
 		realloc(newCapacity, copyValue);
 	}
 
-	DynamicArray(const size_t& newCapacity, ValueType&& moveValue) {                 // Temporary type Constructor
+	constexpr DynamicArray(const size_t& newCapacity, ValueType&& moveValue) {       // Temporary type Constructor
 		realloc(newCapacity, std::move(moveValue));
 	}
 
-	DynamicArray(const DynamicArray<ValueType>& other) {                             // Copy Constructor
+	constexpr DynamicArray(const DynamicArray<ValueType>& other) {                   // Copy Constructor
 		_array = alloc(other._capacity);
 		for (size_t i = 0; i < other._size; i++)
-			new(&_array[i]) ValueType(other._array[i]);
+			std::construct_at(&_array[i], other._array[i]);
 
 		_size = other._size;
 		_capacity = other._capacity;
 	}
 
-	DynamicArray(DynamicArray<ValueType>&& other) noexcept {                         // Move Constructor
+	constexpr DynamicArray(DynamicArray<ValueType>&& other) noexcept {               // Move Constructor
 		_array = alloc(other._capacity);
 		for (size_t i = 0; i < other._size; i++)
-			new(&_array[i]) ValueType(std::move(other._array[i]));
+			std::construct_at(&_array[i], std::move(other._array[i]));
 
 		_size = other._size;
 		_capacity = other._capacity;
 	}
 
-	~DynamicArray() {                                                                // Destructor
+	constexpr ~DynamicArray() {                                                      // Destructor
 		clear();
 		dealloc();
 	}
@@ -57,13 +61,13 @@ public:
 public:
 	// Main functions
 
-	void reserve(const size_t& newCapacity) {                                     // Allocate memory and move values if needed
+	constexpr void reserve(const size_t& newCapacity) {                           // Allocate memory and move values if needed
 		if (newCapacity < _size)
 			_size = newCapacity;
 
 		ValueType* newArray = alloc(newCapacity);
 		for (size_t i = 0; i < _size; i++)
-			new(&newArray[i]) ValueType(std::move(_array[i]));
+			std::construct_at(&newArray[i], std::move(_array[i]));
 
 		destruct_all();
 		dealloc();
@@ -72,57 +76,66 @@ public:
 		_capacity = newCapacity;
 	}
 
-	void shrink_to_fit() {                                                       // Allocate memory with capacity equal to size and move values there
+	constexpr void shrink_to_fit() {                                             // Allocate memory with capacity equal to size and move values there
 		reserve(_size);
 	}
 
 	template<class... Args>
-	void realloc(const size_t& newCapacity, Args&&... args) {                    // Allocate memory and populate it with objects constructed with given arguments (delete old)
+	constexpr void realloc(const size_t& newCapacity, Args&&... args) {          // Allocate memory and populate it with objects constructed with given arguments (delete old)
 		realloc_emplace(newCapacity, std::forward<Args>(args)...);
 	}
 
-	void realloc(const size_t& newCapacity, const ValueType& copyValue) {        // Allocate memory and populate it with given reference (delete old)
+	constexpr void realloc(const size_t& newCapacity, const ValueType& copyValue) {        // Allocate memory and populate it with given reference (delete old)
 		realloc_emplace(newCapacity, copyValue);
 	}
 
-	void realloc(const size_t& newCapacity, ValueType&& moveValue) {             // Allocate memory and populate it with given temporary (delete old)
+	constexpr void realloc(const size_t& newCapacity, ValueType&& moveValue) {   // Allocate memory and populate it with given temporary (delete old)
 		realloc_emplace(newCapacity, std::move(moveValue));
 	}
 
 	template<class... Args>
-	void resize(const size_t& newSize, Args&&... args) {                         // Change size and Construct/Destruct objects with given arguments if needed
+	constexpr void resize(const size_t& newSize, Args&&... args) {               // Change size and Construct/Destruct objects with given arguments if needed
 		resize_emplace(newSize, std::forward<Args>(args)...);
 	}
 
-	void resize(const size_t& newSize, const ValueType& copyValue) {             // Change size and Construct/Destruct objects with given reference if needed
+	constexpr void resize(const size_t& newSize, const ValueType& copyValue) {   // Change size and Construct/Destruct objects with given reference if needed
 		resize_emplace(newSize, copyValue);
 	}
 
-	void resize(const size_t& newSize, ValueType&& moveValue) {                  // Change size and Construct/Destruct objects with given temporary if needed
+	constexpr void resize(const size_t& newSize, ValueType&& moveValue) {        // Change size and Construct/Destruct objects with given temporary if needed
 		resize_emplace(newSize, std::move(moveValue));
 	}
+
+	void resize_for_overwrite(const size_t& newSize) {                          // Change size without constructing new values, the caller writes them before reading (not constexpr)
+		static_assert(std::is_trivially_copyable_v<ValueType>, "resize_for_overwrite needs trivially copyable values");
+
+		if (newSize > _capacity)
+			reserve(newSize);
+
+		_size = newSize;
+	}
 	
 	template<class... Args>
-	void emplace_back(Args&&... args) {                                          // Construct object using arguments (Args) and add it to the tail
+	constexpr void emplace_back(Args&&... args) {                                // Construct object using arguments (Args) and add it to the tail
 		extend_if_full();
-		new(&_array[_size++]) ValueType(std::forward<Args>(args)...);
+		std::construct_at(&_array[_size++], std::forward<Args>(args)...);
 	}
 
-	void push_back(const ValueType& copyValue) {                                 // Construct object using reference and add it to the tail
+	constexpr void push_back(const ValueType& copyValue) {                       // Construct object using reference and add it to the tail
 		emplace_back(copyValue);
 	}
 
-	void push_back(ValueType&& moveValue) {                                      // Construct object using temporary and add it to the tail
+	constexpr void push_back(ValueType&& moveValue) {                            // Construct object using temporary and add it to the tail
 		emplace_back(std::move(moveValue));
 	}
 
-	void pop_back() {                                                            // Remove last component
+	constexpr void pop_back() {                                                  // Remove last component
 		if (_size > 0)
-			_array[--_size].~ValueType();
+			std::destroy_at(&_array[--_size]);
 	}
 	
 	template<class... Args>
-	Iterator emplace(const Iterator& iterator, Args&&... args) {                 // Emplace object at iterator position with given arguments
+	constexpr Iterator emplace(const Iterator& iterator, Args&&... args) {       // Emplace object at iterator position with given arguments
 		size_t index = get_iterator_index(iterator);
 		if (index < 0 || index > _size)
 			throw std::out_of_range("Array emplace iterator outside range...");
@@ -131,21 +144,21 @@ public:
 		for (size_t i = _size - 1; i > index; i--)
 			_array[i] = _array[i - 1];
 
-		_array[index].~ValueType();
-		new(&_array[index]) ValueType(std::forward<Args>(args)...);
+		std::destroy_at(&_array[index]);
+		std::construct_at(&_array[index], std::forward<Args>(args)...);
 
 		return Iterator(_array + index);
 	}
 
-	Iterator push(const Iterator& iterator, const ValueType& copyValue) {        // Push copy object at iterator position
+	constexpr Iterator push(const Iterator& iterator, const ValueType& copyValue) {        // Push copy object at iterator position
 		return emplace(iterator, copyValue);
 	}
 
-	Iterator push(const Iterator& iterator, ValueType&& moveValue) {             // Push temporary object at iterator position
+	constexpr Iterator push(const Iterator& iterator, ValueType&& moveValue) {   // Push temporary object at iterator position
 		return emplace(iterator, std::move(moveValue));
 	}
 
-	Iterator pop(const Iterator& iterator) {                                     // Remove component at iterator position
+	constexpr Iterator pop(const Iterator& iterator) {                           // Remove component at iterator position
 		if (iterator == end())
 			throw std::out_of_range("Array pop iterator outside range...");
 
@@ -160,31 +173,45 @@ public:
 		return iterator;
 	}
 
-	const size_t capacity() const {                                       // Get capacity
+	constexpr const size_t capacity() const {                             // Get capacity
 		return _capacity;
 	}
 
-	const size_t size() const {                                           // Get size
+	constexpr const size_t size() const {                                 // Get size
 		return _size;
 	}
 
-	void clear() {                                                        // Remove ALL components but keep memory
+	constexpr void clear() {                                              // Remove ALL components but keep memory
 		destruct_all();
 		_size = 0;
 	}
 
-	bool empty() const {                                                  // Check if array is empty
+	constexpr bool empty() const {                                        // Check if array is empty
 		return _size == 0;
 	}
 
-	const ValueType& at(const size_t& index) const {                      // Acces object at index with check (read only)
+	constexpr void swap(DynamicArray<ValueType>& other) noexcept {        // Exchange storage with other without touching components
+		std::swap(_size, other._size);
+		std::swap(_capacity, other._capacity);
+		std::swap(_array, other._array);
+	}
+
+	constexpr ValueType* data() {                                         // Get pointer to the first component
+		return _array;
+	}
+
+	constexpr const ValueType* data() const {                             // Get pointer to the first component (read only)
+		return _array;
+	}
+
+	constexpr const ValueType& at(const size_t& index) const {            // Acces object at index with check (read only)
 		if (index < 0 || index >= _size)
 			throw std::out_of_range("Invalid Index...");
 
 		return _array[index];
 	}
 
-	ValueType& at(const size_t& index) {                                  // Acces object at index with check
+	constexpr ValueType& at(const size_t& index) {                        // Acces object at index with check
 		if (index < 0 || index >= _size)
 			throw std::out_of_range("Invalid Index...");
 
@@ -194,15 +221,23 @@ public:
 public:
 	// Operators
 
-	const ValueType& operator[](const size_t& index) const {              // Acces object at index (read only)
+	constexpr const ValueType& operator[](const size_t& index) const {    // Acces object at index (read only)
 		return _array[index];
 	}
 
-	ValueType& operator[](const size_t& index) {                          // Acces object at index
+	constexpr ValueType& operator[](const size_t& index) {                // Acces object at index
 		return _array[index];
 	}
 
-	DynamicArray<ValueType>& operator=(const DynamicArray<ValueType>& other) {         // Assign operator using reference
+	constexpr operator std::span<ValueType>() {                           // View components as span
+		return std::span<ValueType>(_array, _size);
+	}
+
+	constexpr operator std::span<const ValueType>() const {               // View components as span (read only)
+		return std::span<const ValueType>(_array, _size);
+	}
+
+	constexpr DynamicArray<ValueType>& operator=(const DynamicArray<ValueType>& other) {         // Assign operator using reference
 		if (_array == other._array)
 			return *this;
 
@@ -211,14 +246,14 @@ public:
 
 		_array = alloc(other._capacity);
 		for (size_t i = 0; i < other._size; i++)
-			new(&_array[i]) ValueType(other._array[i]);
+			std::construct_at(&_array[i], other._array[i]);
 
 		_size = other._size;
 		_capacity = other._capacity;
 		return *this;
 	}
 
-	DynamicArray<ValueType>& operator=(DynamicArray<ValueType>&& other) noexcept {     // Assign operator using temporary
+	constexpr DynamicArray<ValueType>& operator=(DynamicArray<ValueType>&& other) noexcept {     // Assign operator using temporary
 		if (_array == other._array)
 			return *this;
 
@@ -227,7 +262,7 @@ public:
 
 		_array = alloc(other._capacity);
 		for (size_t i = 0; i < other._size; i++)
-			new(&_array[i]) ValueType(std::move(other._array[i]));
+			std::construct_at(&_array[i], std::move(other._array[i]));
 
 		_size = other._size;
 		_capacity = other._capacity;
@@ -237,19 +272,35 @@ public:
 public:
 	// Iterator specific functions
 
-	Iterator begin() const {
+	constexpr Iterator begin() {
 		return Iterator(_array);
 	}
 
-	Iterator end() const {
+	constexpr ConstIterator begin() const {
+		return ConstIterator(_array);
+	}
+
+	constexpr ConstIterator cbegin() const {
+		return ConstIterator(_array);
+	}
+
+	constexpr Iterator end() {
 		return Iterator(_array + _size);
 	}
 
+	constexpr ConstIterator end() const {
+		return ConstIterator(_array + _size);
+	}
+
+	constexpr ConstIterator cend() const {
+		return ConstIterator(_array + _size);
+	}
+
 private:
 	// Others
 
 	template<class... Args>
-	void realloc_emplace(const size_t& newCapacity, Args&&... args) {     // Allocate memory and populate it with objects constructed with given arguments (delete old)
+	constexpr void realloc_emplace(const size_t& newCapacity, Args&&... args) {     // Allocate memory and populate it with objects constructed with given arguments (delete old)
 		destruct_all();
 		dealloc();
 
@@ -258,43 +309,44 @@ private:
 
 		_array = alloc(_capacity);
 		for (size_t i = 0; i < _capacity; i++)
-			new(&_array[i]) ValueType(std::forward<Args>(args)...);
+			std::construct_at(&_array[i], std::forward<Args>(args)...);
 	}
 
 	template<class... Args>
-	void resize_emplace(const size_t& newSize, Args&&... args) {         // Change size and Construct/Destruct objects with given arguments if needed
+	constexpr void resize_emplace(const size_t& newSize, Args&&... args) {         // Change size and Construct/Destruct objects with given arguments if needed
 		if (newSize < _size)
 			for (size_t i = newSize; i < _size; i++)
-				_array[i].~ValueType();
+				std::destroy_at(&_array[i]);
 		else {
 			if (newSize > _capacity)
 				reserve(newSize);
 			for (size_t i = _size; i < newSize; i++)
-				new(&_array[i]) ValueType(std::forward<Args>(args)...);
+				std::construct_at(&_array[i], std::forward<Args>(args)...);
 		}
 
 		_size = newSize;
 	}
 
-	const size_t get_iterator_index(const Iterator& iterator) const {    // Get the position for the element in array from iterator
-		return iterator.Ptr - begin().Ptr;
+	constexpr const size_t get_iterator_index(const Iterator& iterator) const {    // Get the position for the element in array from iterator
+		return iterator.Ptr - _array;
 	}
 
-	void extend_if_full() {                                              // Reserve 50% more capacity when full
+	constexpr void extend_if_full() {                                    // Reserve 50% more capacity when full
 		if (_size >= _capacity)
 			reserve(_capacity + _capacity / 2 + 1);
 	}
 
-	void destruct_all() {                                                // Call ~Destructor for ALL components held by this
+	constexpr void destruct_all() {                                      // Call ~Destructor for ALL components held by this
 		for (size_t i = 0; i < _size; i++)
-			_array[i].~ValueType();
+			std::destroy_at(&_array[i]);
 	}
 
-	ValueType* alloc(const size_t& newCapacity) const {                  // Allocate memory without using Constructor
-		return (ValueType*) ::operator new(newCapacity * sizeof(ValueType));
+	constexpr ValueType* alloc(const size_t& newCapacity) const {        // Allocate memory without using Constructor
+		return std::allocator<ValueType>().allocate(newCapacity);
 	}
 
-	void dealloc() {                                                     // Deallocate memory without using ~Destructor
-		::operator delete(_array, _capacity * sizeof(ValueType));
+	constexpr void dealloc() {                                           // Deallocate memory without using ~Destructor
+		if (_array != nullptr)
+			std::allocator<ValueType>().deallocate(_array, _capacity);
 	}
 };
\ No newline at end of file
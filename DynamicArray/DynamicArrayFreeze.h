@@ -0,0 +1,17 @@
+#pragma once
+#include <array>
+#include "DynamicArray.h"
+
+template<auto Generator>
+constexpr auto freeze_array() {                                                  // Copy the DynamicArray returned by constexpr Generator into a std::array
+	using ValueType = typename decltype(Generator())::ValueType;                 // e.g. static constexpr auto Table = freeze_array<[] { DynamicArray<int> a; ...; return a; }>();
+
+	constexpr size_t size = Generator().size();                                  // Array built and released during constant evaluation, only its size survives
+	const DynamicArray<ValueType> array = Generator();
+
+	std::array<ValueType, size> frozen{};
+	for (size_t i = 0; i < size; i++)
+		frozen[i] = array[i];
+
+	return frozen;
+}
\ No newline at end of file
@@ -1,80 +1,183 @@
 #pragma once
+#include <compare>
+#include <cstddef>
+#include <iterator>
 
 template<class DynamicArray>
-class DynamicArrayIterator
+class DynamicArrayConstIterator                                                   // Contiguous iterator over DynamicArray (read only)
 {
 public:
 	using ValueType = typename DynamicArray::ValueType;
 
+	using iterator_concept = std::contiguous_iterator_tag;
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type = ValueType;
+	using difference_type = ptrdiff_t;
+	using pointer = const ValueType*;
+	using reference = const ValueType&;
+
 	ValueType* Ptr = nullptr;
 
 public:
-	DynamicArrayIterator() = default;
+	constexpr DynamicArrayConstIterator() = default;
 
-	DynamicArrayIterator(ValueType* ptr)
+	constexpr DynamicArrayConstIterator(ValueType* ptr)
 		:Ptr(ptr) { }
 
-	DynamicArrayIterator& operator++() {
+	constexpr DynamicArrayConstIterator& operator++() {
 		Ptr++;
 		return *this;
 	}
 
-	DynamicArrayIterator& operator++(int) {
-		DynamicArrayIterator temp = *this;
+	constexpr DynamicArrayConstIterator operator++(int) {
+		DynamicArrayConstIterator temp = *this;
 		++(*this);
 		return temp;
 	}
 
-	DynamicArrayIterator& operator+=(const size_t diff) {
+	constexpr DynamicArrayConstIterator& operator+=(const difference_type diff) {
 		Ptr += diff;
 		return *this;
 	}
 
-	DynamicArrayIterator operator+(const size_t diff) const {
-		DynamicArrayIterator temp = *this;
+	constexpr DynamicArrayConstIterator operator+(const difference_type diff) const {
+		DynamicArrayConstIterator temp = *this;
 		temp += diff;
 		return temp;
 	}
 
-	DynamicArrayIterator& operator--() {
+	friend constexpr DynamicArrayConstIterator operator+(const difference_type diff, const DynamicArrayConstIterator& iterator) {
+		return iterator + diff;
+	}
+
+	constexpr DynamicArrayConstIterator& operator--() {
 		Ptr--;
 		return *this;
 	}
 
-	DynamicArrayIterator& operator--(int) {
-		DynamicArrayIterator temp = *this;
+	constexpr DynamicArrayConstIterator operator--(int) {
+		DynamicArrayConstIterator temp = *this;
 		--(*this);
 		return temp;
 	}
 
-	DynamicArrayIterator& operator-=(const size_t diff) {
+	constexpr DynamicArrayConstIterator& operator-=(const difference_type diff) {
 		Ptr -= diff;
 		return *this;
 	}
 
-	DynamicArrayIterator operator-(const size_t diff) const {
-		DynamicArrayIterator temp = *this;
+	constexpr DynamicArrayConstIterator operator-(const difference_type diff) const {
+		DynamicArrayConstIterator temp = *this;
 		temp -= diff;
 		return temp;
 	}
 
-	ValueType& operator[](const int& index) const {
+	constexpr difference_type operator-(const DynamicArrayConstIterator& other) const {
+		return Ptr - other.Ptr;
+	}
+
+	constexpr reference operator[](const difference_type index) const {
 		return *(Ptr + index);
 	}
 
-	ValueType* operator->() {
+	constexpr pointer operator->() const {
 		return Ptr;
 	}
 
-	ValueType& operator*() {
+	constexpr reference operator*() const {
 		return *Ptr;
 	}
 
-	bool operator==(const DynamicArrayIterator& other) const {
+	constexpr bool operator==(const DynamicArrayConstIterator& other) const {
 		return Ptr == other.Ptr;
 	}
 
-	bool operator!=(const DynamicArrayIterator& other) const {
-		return !(*this == other);
+	constexpr std::strong_ordering operator<=>(const DynamicArrayConstIterator& other) const {
+		return Ptr <=> other.Ptr;
+	}
+};
+
+template<class DynamicArray>
+class DynamicArrayIterator : public DynamicArrayConstIterator<DynamicArray>       // Contiguous iterator over DynamicArray
+{
+private:
+	using Base = DynamicArrayConstIterator<DynamicArray>;
+
+public:
+	using ValueType = typename DynamicArray::ValueType;
+
+	using iterator_concept = std::contiguous_iterator_tag;
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type = ValueType;
+	using difference_type = ptrdiff_t;
+	using pointer = ValueType*;
+	using reference = ValueType&;
+
+public:
+	constexpr DynamicArrayIterator() = default;
+
+	constexpr DynamicArrayIterator(ValueType* ptr)
+		:Base(ptr) { }
+
+	constexpr DynamicArrayIterator& operator++() {
+		Base::operator++();
+		return *this;
+	}
+
+	constexpr DynamicArrayIterator operator++(int) {
+		DynamicArrayIterator temp = *this;
+		++(*this);
+		return temp;
+	}
+
+	constexpr DynamicArrayIterator& operator+=(const difference_type diff) {
+		Base::operator+=(diff);
+		return *this;
+	}
+
+	constexpr DynamicArrayIterator operator+(const difference_type diff) const {
+		DynamicArrayIterator temp = *this;
+		temp += diff;
+		return temp;
+	}
+
+	friend constexpr DynamicArrayIterator operator+(const difference_type diff, const DynamicArrayIterator& iterator) {
+		return iterator + diff;
+	}
+
+	constexpr DynamicArrayIterator& operator--() {
+		Base::operator--();
+		return *this;
+	}
+
+	constexpr DynamicArrayIterator operator--(int) {
+		DynamicArrayIterator temp = *this;
+		--(*this);
+		return temp;
+	}
+
+	constexpr DynamicArrayIterator& operator-=(const difference_type diff) {
+		Base::operator-=(diff);
+		return *this;
+	}
+
+	using Base::operator-;
+
+	constexpr DynamicArrayIterator operator-(const difference_type diff) const {
+		DynamicArrayIterator temp = *this;
+		temp -= diff;
+		return temp;
+	}
+
+	constexpr reference operator[](const difference_type index) const {
+		return *(this->Ptr + index);
+	}
+
+	constexpr pointer operator->() const {
+		return this->Ptr;
+	}
+
+	constexpr reference operator*() const {
+		return *this->Ptr;
 	}
 };
\ No newline at end of file
@@ -1,4 +1,6 @@
 #pragma once
+#include <memory>
+#include <utility>
 #include "LinkedListIterator.h"
 #include "LinkedListNode.h"
 
@@ -7,13 +9,14 @@ class LinkedList
 {
 public:
 	using ValueType = Type;                                                 // Type for stored values
-	using Node = typename LinkedListNode<LinkedList<ValueType>>;            // Node type
-	using Iterator = typename LinkedListIterator<LinkedList<ValueType>>;    // Iterator type
+	using Node = LinkedListNode<LinkedList<ValueType>>;                     // Node type
+	using Iterator = LinkedListIterator<LinkedList<ValueType>>;             // Iterator type
+	using ConstIterator = LinkedListConstIterator<LinkedList<ValueType>>;           // Const Iterator type
 
 private:
 	size_t _size = 0;                                                       // Number of Nodes held by this
-	Node* _head = new Node();                                               // Head of this list
-	Node* _tail = new Node();                                               // Tail of this list
+	Node* _head = new Node(typename Node::SentinelTag());                   // Head of this list
+	Node* _tail = new Node(typename Node::SentinelTag());                   // Tail of this list
 	mutable Node* _workspaceNode = nullptr;                                 // Auxiliary Node for work
 
 public:
@@ -41,7 +44,7 @@ public:
 	}
 
 	LinkedList(const LinkedList& other) : LinkedList() {                        // Copy Constructor
-		_workspaceNode = other._head;
+		_workspaceNode = other._head->Next;
 		while (_size < other._size) {
 			push_back(_workspaceNode->Value);
 			_workspaceNode = _workspaceNode->Next;
@@ -49,7 +52,7 @@ public:
 	}
 
 	LinkedList(LinkedList<ValueType>&& other) noexcept : LinkedList() {         // Move Constructor
-		_workspaceNode = other._head;
+		_workspaceNode = other._head->Next;
 		while (_size < other._size) {
 			push_back(std::move(_workspaceNode->Value));
 			_workspaceNode = _workspaceNode->Next;
@@ -58,6 +61,8 @@ public:
 
 	~LinkedList() {                                                             // Destructor
 		clear();
+		delete _head;
+		delete _tail;
 	}
 
 public:
@@ -103,7 +108,7 @@ public:
 			_tail->Previous = _tail->Previous->Previous;
 			_tail->Previous->Next = _tail;
 
-			delete _workspaceNode;
+			destroy_node(_workspaceNode);
 			_size--;
 		}
 	}
@@ -135,7 +140,7 @@ public:
 			_head->Next = _head->Next->Next;
 			_head->Next->Previous = _head;
 
-			delete _workspaceNode;
+			destroy_node(_workspaceNode);
 			_size--;
 		}
 	}
@@ -177,12 +182,39 @@ public:
 		_workspaceNode->Next->Previous = _workspaceNode->Previous;
 
 		Iterator nextIterator = Iterator(_workspaceNode->Next);
-		delete _workspaceNode;
+		destroy_node(_workspaceNode);
 		_size--;
 
 		return nextIterator;
 	}
 
+	ValueType extract_front() {                                              // Return first component (moved out) and remove it
+		if (_head->Next == _tail)
+			throw std::out_of_range("List extract on empty list...");
+
+		ValueType value = std::move(_head->Next->Value);
+		pop_front();
+		return value;
+	}
+
+	ValueType extract_back() {                                               // Return last component (moved out) and remove it
+		if (_tail->Previous == _head)
+			throw std::out_of_range("List extract on empty list...");
+
+		ValueType value = std::move(_tail->Previous->Value);
+		pop_back();
+		return value;
+	}
+
+	std::pair<ValueType, Iterator> extract(Iterator iterator) {              // Return component at iterator (moved out) and the iterator after it, remove it
+		if (iterator == end())
+			throw std::out_of_range("List extract iterator outside range...");
+
+		ValueType value = std::move(*iterator);
+		Iterator nextIterator = pop(iterator);
+		return { std::move(value), nextIterator };
+	}
+
 	ValueType& front() {                                                     // Get the value of the first component
 		return _head->Next->Value;
 	}
@@ -210,7 +242,7 @@ public:
 	LinkedList& operator=(const LinkedList<ValueType>& other) {              // Assign operator using reference
 		clear();
 		
-		_workspaceNode = other._head;
+		_workspaceNode = other._head->Next;
 		while (_size < other._size) {
 			push_back(_workspaceNode->Value);
 			_workspaceNode = _workspaceNode->Next;
@@ -221,7 +253,7 @@ public:
 	LinkedList& operator=(LinkedList<ValueType>&& other) noexcept {          // Assign operator using temporary
 		clear();
 
-		_workspaceNode = other._head;
+		_workspaceNode = other._head->Next;
 		while (_size < other._size) {
 			push_back(std::move(_workspaceNode->Value));
 			_workspaceNode = _workspaceNode->Next;
@@ -236,11 +268,27 @@ public:
 		return Iterator(_head->Next);
 	}
 
+	ConstIterator begin() const {
+		return ConstIterator(_head->Next);
+	}
+
+	ConstIterator cbegin() const {
+		return ConstIterator(_head->Next);
+	}
+
 	Iterator end() {
 
 		return Iterator(_tail);
 	}
 
+	ConstIterator end() const {
+		return ConstIterator(_tail);
+	}
+
+	ConstIterator cend() const {
+		return ConstIterator(_tail);
+	}
+
 	Iterator at(const size_t& index) {
 		if (index < 0 || index >= _size)
 			throw std::out_of_range("Invalid Index...");
@@ -259,6 +307,11 @@ private:
 			emplace_back(std::forward<Args>(args)...);                       // Emplace type addition
 	}
 
+	void destroy_node(Node* node) {                                          // Destroy the value of an element node, then free it
+		std::destroy_at(&node->Value);
+		delete node;
+	}
+
 	Node* scroll_node(const size_t& index) const {                           // Get object in the list at index position by going through all components
 		_workspaceNode = _head->Next;
 		if (_workspaceNode != _tail)
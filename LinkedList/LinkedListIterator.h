@@ -1,32 +1,40 @@
 #pragma once
+#include <cstddef>
+#include <iterator>
 
 template<class LinkedList>
-class LinkedListIterator
+class LinkedListConstIterator                                     // Bidirectional iterator over LinkedList (read only)
 {
 public:
 	using ValueType = typename LinkedList::ValueType;
 	using Node = typename LinkedList::Node;                        // Node type accessed via friendship
 
+	using iterator_category = std::bidirectional_iterator_tag;
+	using value_type = ValueType;
+	using difference_type = ptrdiff_t;
+	using pointer = const ValueType*;
+	using reference = const ValueType&;
+
 	Node* NodePtr = nullptr;
 
 public:
-	LinkedListIterator() = default;
+	LinkedListConstIterator() = default;
 
-	LinkedListIterator(Node* nodePtr)
+	LinkedListConstIterator(Node* nodePtr)
 		:NodePtr(nodePtr) { }
 
-	LinkedListIterator& operator++() {
+	LinkedListConstIterator& operator++() {
 		NodePtr = NodePtr->Next;
 		return *this;
 	}
 
-	LinkedListIterator& operator++(int) {
-		LinkedListIterator iterator = NodePtr;
+	LinkedListConstIterator operator++(int) {
+		LinkedListConstIterator iterator = *this;
 		NodePtr = NodePtr->Next;
 		return iterator;
 	}
 
-	LinkedListIterator& operator+=(const size_t diff) {
+	LinkedListConstIterator& operator+=(const size_t diff) {
 		size_t aux = diff;
 		while (aux) {
 			NodePtr = NodePtr->Next;
@@ -35,24 +43,24 @@ public:
 		return *this;
 	}
 
-	LinkedListIterator operator+(const size_t diff) {
-		LinkedListIterator temp = *this;
+	LinkedListConstIterator operator+(const size_t diff) const {
+		LinkedListConstIterator temp = *this;
 		temp += diff;
 		return temp;
 	}
 
-	LinkedListIterator& operator--() {
+	LinkedListConstIterator& operator--() {
 		NodePtr = NodePtr->Previous;
 		return *this;
 	}
 
-	LinkedListIterator& operator--(int) {
-		LinkedListIterator iterator = NodePtr;
+	LinkedListConstIterator operator--(int) {
+		LinkedListConstIterator iterator = *this;
 		NodePtr = NodePtr->Previous;
 		return iterator;
 	}
 
-	LinkedListIterator& operator-=(const size_t diff) {
+	LinkedListConstIterator& operator-=(const size_t diff) {
 		size_t aux = diff;
 		while (aux) {
 			NodePtr = NodePtr->Previous;
@@ -61,25 +69,96 @@ public:
 		return *this;
 	}
 
-	LinkedListIterator operator-(const size_t diff) {
-		LinkedListIterator temp = *this;
+	LinkedListConstIterator operator-(const size_t diff) const {
+		LinkedListConstIterator temp = *this;
 		temp -= diff;
 		return temp;
 	}
 
-	Node* operator->() {
-		return NodePtr;
+	pointer operator->() const {
+		return &NodePtr->Value;
 	}
 
-	ValueType& operator*() {
+	reference operator*() const {
 		return NodePtr->Value;
 	}
 
-	bool operator==(const LinkedListIterator& other) const {
+	bool operator==(const LinkedListConstIterator& other) const {
 		return NodePtr == other.NodePtr;
 	}
+};
+
+template<class LinkedList>
+class LinkedListIterator : public LinkedListConstIterator<LinkedList>     // Bidirectional iterator over LinkedList
+{
+private:
+	using Base = LinkedListConstIterator<LinkedList>;
+
+public:
+	using ValueType = typename LinkedList::ValueType;
+	using Node = typename LinkedList::Node;
+
+	using iterator_category = std::bidirectional_iterator_tag;
+	using value_type = ValueType;
+	using difference_type = ptrdiff_t;
+	using pointer = ValueType*;
+	using reference = ValueType&;
+
+public:
+	LinkedListIterator() = default;
+
+	LinkedListIterator(Node* nodePtr)
+		:Base(nodePtr) { }
+
+	LinkedListIterator& operator++() {
+		Base::operator++();
+		return *this;
+	}
+
+	LinkedListIterator operator++(int) {
+		LinkedListIterator iterator = *this;
+		Base::operator++();
+		return iterator;
+	}
+
+	LinkedListIterator& operator+=(const size_t diff) {
+		Base::operator+=(diff);
+		return *this;
+	}
+
+	LinkedListIterator operator+(const size_t diff) const {
+		LinkedListIterator temp = *this;
+		temp += diff;
+		return temp;
+	}
+
+	LinkedListIterator& operator--() {
+		Base::operator--();
+		return *this;
+	}
+
+	LinkedListIterator operator--(int) {
+		LinkedListIterator iterator = *this;
+		Base::operator--();
+		return iterator;
+	}
+
+	LinkedListIterator& operator-=(const size_t diff) {
+		Base::operator-=(diff);
+		return *this;
+	}
+
+	LinkedListIterator operator-(const size_t diff) const {
+		LinkedListIterator temp = *this;
+		temp -= diff;
+		return temp;
+	}
+
+	pointer operator->() const {
+		return &this->NodePtr->Value;
+	}
 
-	bool operator!=(const LinkedListIterator& other) const {
-		return !(*this == other);
+	reference operator*() const {
+		return this->NodePtr->Value;
 	}
 };
@@ -6,20 +6,23 @@ struct LinkedListNode
 public:
 	using ValueType = typename LinkedList::ValueType;
 
-	ValueType Value;                                                              // Data
+	struct SentinelTag { };                                                       // Selects the head/tail Constructor
+
+	union { ValueType Value; };                                                   // Data (never constructed in head/tail, LinkedList destroys it explicitly)
 	LinkedListNode* Previous = nullptr;                                           // Reference to previous 
 	LinkedListNode* Next = nullptr;                                               // Reference to next
 
+	LinkedListNode(SentinelTag) { }                                               // Head/tail Constructor, no ValueType is built
+
 	template<class... Args>
-	LinkedListNode(Args&&... args) {                                              // Add data using emplace ValueTypepe Constructor
-		new(&Value) ValueType(std::forward<Args>(args)...);
-	}
+	LinkedListNode(Args&&... args)                                                // Add data using emplace ValueTypepe Constructor
+		:Value(std::forward<Args>(args)...) { }
+
+	LinkedListNode(const ValueType& value)                                        // Add data using reference ValueTypepe Constructor
+		:Value(value) { }
 
-	LinkedListNode(const ValueType& value) {                                      // Add data using reference ValueTypepe Constructor
-		new(&Value) ValueType(value);
-	}
+	LinkedListNode(ValueType&& value)                                             // Add data using temporary ValueTypepe Constructor
+		:Value(std::move(value)) { }
 
-	LinkedListNode(ValueType&& value) {                                           // Add data using temporary ValueTypepe Constructor
-		new(&Value) ValueType(std::move(value));
-	}
+	~LinkedListNode() { }                                                         // Destructor (Value is left to LinkedList)
 };
\ No newline at end of file
@@ -0,0 +1,198 @@
+#pragma once
+#include <atomic>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include "MPMCQueueCell.h"
+
+template<class Type>
+class MPMCQueue                                                                 // Bounded multi-producer/multi-consumer queue (Vyukov ring with per-cell sequence numbers)
+{
+public:
+	using ValueType = Type;                                                     // Type for stored values
+	using Cell = MPMCQueueCell<MPMCQueue<ValueType>>;                           // Cell type
+
+	static constexpr size_t CacheLineSize = 64;                                 // Alignment used to keep positions and cells on separate cache lines
+
+	static_assert(std::is_nothrow_move_constructible_v<ValueType> && std::is_nothrow_move_assignable_v<ValueType>,
+		"MPMCQueue values must be nothrow movable: a claimed cell cannot be given back");
+
+private:
+	Cell* _buffer = nullptr;                                                    // Ring of cells
+	size_t _capacity = 0;                                                       // Number of cells (power of 2)
+	size_t _mask = 0;                                                           // _capacity - 1, used to wrap positions
+
+	alignas(CacheLineSize) std::atomic<size_t> _enqueuePos = 0;                 // Next position to be claimed by a producer
+	alignas(CacheLineSize) std::atomic<size_t> _dequeuePos = 0;                 // Next position to be claimed by a consumer
+	char _padding[CacheLineSize - sizeof(std::atomic<size_t>)];                 // Keep neighbouring objects off the consumer cache line
+
+public:
+	// Constructors
+
+	MPMCQueue(const size_t& capacity) {                                         // Capacity is rounded up to a power of 2 (minimum 2)
+		_capacity = 2;
+		while (_capacity < capacity)
+			_capacity <<= 1;
+		_mask = _capacity - 1;
+
+		_buffer = alloc(_capacity);
+		for (size_t i = 0; i < _capacity; i++)
+			new(&_buffer[i].Sequence) std::atomic<size_t>(i);
+	}
+
+	MPMCQueue(const MPMCQueue&) = delete;
+	MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+	~MPMCQueue() {                                                              // Destructor
+		clear();
+		dealloc();
+	}
+
+public:
+	// Main functions (non-blocking)
+
+	template<class... Args>
+	bool try_emplace(Args&&... args) {                                          // Construct object using arguments (Args) at the tail if a cell is free
+		if constexpr (!std::is_nothrow_constructible_v<ValueType, Args&&...>) {
+			ValueType value(std::forward<Args>(args)...);                       // May throw, so build it before a cell is claimed (args are consumed even if full)
+			return try_emplace(std::move(value));
+		}
+		else {
+			size_t pos;
+			Cell* cell = claim_enqueue(pos);
+			if (cell == nullptr)
+				return false;
+
+			new(cell->Storage) ValueType(std::forward<Args>(args)...);
+			cell->Sequence.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+	}
+
+	bool try_enqueue(const ValueType& copyValue) {                              // Add copy to the tail if a cell is free
+		return try_emplace(copyValue);
+	}
+
+	bool try_enqueue(ValueType&& moveValue) {                                   // Add temporary to the tail if a cell is free
+		return try_emplace(std::move(moveValue));
+	}
+
+	bool try_dequeue(ValueType& out) {                                          // Move first component into out and remove it, if any
+		size_t pos;
+		Cell* cell = claim_dequeue(pos);
+		if (cell == nullptr)
+			return false;
+
+		out = std::move(*cell->value());
+		cell->value()->~ValueType();
+		cell->Sequence.store(pos + _capacity, std::memory_order_release);
+		return true;
+	}
+
+public:
+	// Main functions (spinning)
+
+	template<class... Args>
+	void emplace(Args&&... args) {                                              // Construct object using arguments (Args) at the tail, spin while full
+		if constexpr (!std::is_nothrow_constructible_v<ValueType, Args&&...>) {
+			ValueType value(std::forward<Args>(args)...);                       // Construct once, not on every retry
+			emplace(std::move(value));
+		}
+		else {
+			size_t spins = 0;
+			while (!try_emplace(std::forward<Args>(args)...))
+				backoff(spins);
+		}
+	}
+
+	void enqueue(const ValueType& copyValue) {                                  // Add copy to the tail, spin while full
+		emplace(copyValue);
+	}
+
+	void enqueue(ValueType&& moveValue) {                                       // Add temporary to the tail, spin while full
+		emplace(std::move(moveValue));
+	}
+
+	void dequeue(ValueType& out) {                                              // Move first component into out and remove it, spin while empty
+		size_t spins = 0;
+		while (!try_dequeue(out))
+			backoff(spins);
+	}
+
+	const size_t capacity() const {                                             // Get capacity
+		return _capacity;
+	}
+
+	const size_t size() const {                                                 // Get size (approximate while other threads operate)
+		size_t tail = _enqueuePos.load(std::memory_order_acquire);
+		size_t head = _dequeuePos.load(std::memory_order_acquire);
+		return tail > head ? tail - head : 0;
+	}
+
+	bool empty() const {                                                        // Check if queue is empty (approximate while other threads operate)
+		return size() == 0;
+	}
+
+private:
+	// Others
+
+	Cell* claim_enqueue(size_t& pos) {                                          // Reserve the tail cell for writing, nullptr when full
+		pos = _enqueuePos.load(std::memory_order_relaxed);
+		while (true) {
+			Cell* cell = &_buffer[pos & _mask];
+			size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+			ptrdiff_t diff = (ptrdiff_t)sequence - (ptrdiff_t)pos;
+
+			if (diff == 0) {
+				if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					return cell;
+			}
+			else if (diff < 0)
+				return nullptr;                                                 // Cell still holds the value from the previous lap
+			else
+				pos = _enqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	Cell* claim_dequeue(size_t& pos) {                                          // Reserve the head cell for reading, nullptr when empty
+		pos = _dequeuePos.load(std::memory_order_relaxed);
+		while (true) {
+			Cell* cell = &_buffer[pos & _mask];
+			size_t sequence = cell->Sequence.load(std::memory_order_acquire);
+			ptrdiff_t diff = (ptrdiff_t)sequence - (ptrdiff_t)(pos + 1);
+
+			if (diff == 0) {
+				if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					return cell;
+			}
+			else if (diff < 0)
+				return nullptr;                                                 // Producer has not published this cell yet
+			else
+				pos = _dequeuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	void clear() {                                                              // Destroy components still held (no other thread may operate)
+		size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+		size_t tail = _enqueuePos.load(std::memory_order_relaxed);
+		for (; pos != tail; pos++)
+			_buffer[pos & _mask].value()->~ValueType();
+
+		_dequeuePos.store(tail, std::memory_order_relaxed);
+	}
+
+	static void backoff(size_t& spins) {                                        // Busy-wait first, then give the core away
+		if (spins++ < 64)
+			std::atomic_signal_fence(std::memory_order_seq_cst);
+		else
+			std::this_thread::yield();
+	}
+
+	Cell* alloc(const size_t& newCapacity) const {                              // Allocate cache line aligned memory without using Constructor
+		return (Cell*) ::operator new(newCapacity * sizeof(Cell), std::align_val_t(alignof(Cell)));
+	}
+
+	void dealloc() {                                                            // Deallocate memory without using ~Destructor
+		::operator delete(_buffer, _capacity * sizeof(Cell), std::align_val_t(alignof(Cell)));
+	}
+};
\ No newline at end of file
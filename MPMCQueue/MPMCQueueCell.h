@@ -0,0 +1,16 @@
+#pragma once
+#include <atomic>
+
+template<class MPMCQueue>
+struct alignas(MPMCQueue::CacheLineSize) MPMCQueueCell                          // Struct that holds raw storage for one value and its turn sequence (one cache line per cell)
+{
+public:
+	using ValueType = typename MPMCQueue::ValueType;
+
+	std::atomic<size_t> Sequence;                                                // Turn marker: position that may write (== pos) or read (== pos + 1) this cell
+	alignas(ValueType) unsigned char Storage[sizeof(ValueType)];                 // Raw memory for data (constructed only while the cell is full)
+
+	ValueType* value() {                                                         // Access data stored in this cell
+		return reinterpret_cast<ValueType*>(Storage);
+	}
+};
\ No newline at end of file
@@ -0,0 +1,215 @@
+#pragma once
+#include <atomic>
+#include <thread>
+#include "MPSCQueueNode.h"
+#include "MPSCQueueHazard.h"
+
+template<class Type>
+class MPSCQueue                                                                 // Unbounded multi-producer/single-consumer queue (Vyukov MPSC with a stub node)
+{
+public:
+	using ValueType = Type;                                                     // Type for stored values
+	using Node = MPSCQueueNode<MPSCQueue<ValueType>>;                           // Node type
+	using Hazard = MPSCQueueHazard<MPSCQueue<ValueType>>;                       // Hazard record type
+
+	static constexpr size_t RetireThreshold = 64;                               // Retired nodes gathered before the consumer scans hazards
+
+private:
+	Node* _head = nullptr;                                                      // Stub node before the first component (consumer only)
+	alignas(64) std::atomic<Node*> _tail = nullptr;                             // Last node, exchanged by producers
+	alignas(64) std::atomic<Node*> _pool = nullptr;                             // Free nodes ready for reuse (Treiber stack)
+	std::atomic<Hazard*> _hazards = nullptr;                                    // Hazard records of producers popping from _pool
+	Node* _retired = nullptr;                                                   // Nodes released by the consumer, waiting to be proven unreferenced
+	size_t _retiredCount = 0;                                                   // Number of nodes in _retired
+
+public:
+	// Constructors
+
+	MPSCQueue() {                                                               // Default Constructor
+		_head = new Node();
+		_tail.store(_head, std::memory_order_relaxed);
+	}
+
+	MPSCQueue(const MPSCQueue&) = delete;
+	MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+	~MPSCQueue() {                                                              // Destructor (no other thread may operate)
+		ValueType* value;
+		while ((value = peek()) != nullptr) {
+			value->~ValueType();
+			advance();
+		}
+		delete _head;
+
+		delete_chain(_pool.load(std::memory_order_relaxed));
+		delete_chain(_retired);
+
+		Hazard* hazard = _hazards.load(std::memory_order_relaxed);
+		while (hazard) {
+			Hazard* next = hazard->Next;
+			delete hazard;
+			hazard = next;
+		}
+	}
+
+public:
+	// Main functions (any thread)
+
+	template<class... Args>
+	void emplace(Args&&... args) {                                              // Construct object using arguments (Args) and add it to the tail
+		Node* newNode = acquire_node();
+		try {
+			new(newNode->Storage) ValueType(std::forward<Args>(args)...);
+		}
+		catch (...) {                                                           // Node was never queued, hand it back instead of leaking it
+			recycle_node(newNode);
+			throw;
+		}
+		newNode->Next.store(nullptr, std::memory_order_relaxed);
+
+		Node* previous = _tail.exchange(newNode, std::memory_order_acq_rel);
+		previous->Next.store(newNode, std::memory_order_release);              // Consumer sees newNode from here on
+	}
+
+	void enqueue(const ValueType& copyValue) {                                  // Construct object using reference and add it to the tail
+		emplace(copyValue);
+	}
+
+	void enqueue(ValueType&& moveValue) {                                       // Construct object using temporary and add it to the tail
+		emplace(std::move(moveValue));
+	}
+
+public:
+	// Main functions (consumer thread only)
+
+	bool try_dequeue(ValueType& out) {                                          // Move first component into out and remove it, if any
+		ValueType* value = peek();
+		if (value == nullptr)
+			return false;
+
+		out = std::move(*value);
+		value->~ValueType();
+		advance();
+		return true;
+	}
+
+	bool empty() const {                                                        // Check if queue is empty (a producer mid-enqueue counts as empty)
+		return _head->Next.load(std::memory_order_acquire) == nullptr;
+	}
+
+private:
+	// Others
+
+	ValueType* peek() const {                                                   // Get first component, nullptr when empty
+		Node* next = _head->Next.load(std::memory_order_acquire);
+		return next ? next->value() : nullptr;
+	}
+
+	void advance() {                                                            // First node becomes the new stub, the old stub is retired
+		Node* oldHead = _head;
+		_head = _head->Next.load(std::memory_order_relaxed);
+		retire(oldHead);
+	}
+
+	Node* acquire_node() {                                                      // Pop a node from the pool (guarded by a hazard pointer) or allocate one
+		if (_pool.load(std::memory_order_relaxed) == nullptr)
+			return new Node();
+
+		Hazard* hazard = acquire_hazard();
+		Node* top = _pool.load(std::memory_order_acquire);
+		while (top) {
+			hazard->Pointer.store(top, std::memory_order_seq_cst);
+			if (_pool.load(std::memory_order_seq_cst) != top) {             // top may have been recycled before it was protected
+				top = _pool.load(std::memory_order_acquire);
+				continue;
+			}
+
+			Node* next = top->Next.load(std::memory_order_relaxed);
+			if (_pool.compare_exchange_weak(top, next, std::memory_order_seq_cst, std::memory_order_acquire))
+				break;
+		}
+		release_hazard(hazard);
+
+		return top ? top : new Node();
+	}
+
+	Hazard* acquire_hazard() {                                                  // Take an inactive record or publish a new one
+		for (Hazard* hazard = _hazards.load(std::memory_order_acquire); hazard; hazard = hazard->Next) {
+			bool inactive = false;
+			if (!hazard->Active.load(std::memory_order_relaxed) &&
+				hazard->Active.compare_exchange_strong(inactive, true, std::memory_order_acquire))
+				return hazard;
+		}
+
+		Hazard* newHazard = new Hazard();
+		newHazard->Active.store(true, std::memory_order_relaxed);
+		newHazard->Next = _hazards.load(std::memory_order_relaxed);
+		while (!_hazards.compare_exchange_weak(newHazard->Next, newHazard, std::memory_order_release, std::memory_order_relaxed));
+
+		return newHazard;
+	}
+
+	void release_hazard(Hazard* hazard) {                                      // Clear protection and give the record back
+		hazard->Pointer.store(nullptr, std::memory_order_release);
+		hazard->Active.store(false, std::memory_order_release);
+	}
+
+	void retire(Node* node) {                                                  // Defer node reuse until no producer holds it as hazard
+		node->Next.store(_retired, std::memory_order_relaxed);
+		_retired = node;
+
+		if (++_retiredCount >= RetireThreshold)
+			reclaim();
+	}
+
+	void reclaim() {                                                           // Move every retired node not published as hazard back to the pool
+		Node* keep = nullptr;
+		size_t keepCount = 0;
+
+		while (_retired) {
+			Node* node = _retired;
+			_retired = node->Next.load(std::memory_order_relaxed);
+
+			if (is_hazard(node)) {
+				node->Next.store(keep, std::memory_order_relaxed);
+				keep = node;
+				keepCount++;
+			}
+			else
+				push_pool(node);
+		}
+
+		_retired = keep;
+		_retiredCount = keepCount;
+	}
+
+	void recycle_node(Node* node) {                                            // Return an unused node to the pool from a producer
+		while (is_hazard(node))                                                // A producer that protected node while it was pool top fails its CAS and moves on
+			std::this_thread::yield();
+
+		push_pool(node);
+	}
+
+	void push_pool(Node* node) {                                               // Push node (not protected by any hazard) on the pool
+		node->Next.store(_pool.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		Node* expected = node->Next.load(std::memory_order_relaxed);
+		while (!_pool.compare_exchange_weak(expected, node, std::memory_order_release, std::memory_order_relaxed))
+			node->Next.store(expected, std::memory_order_relaxed);
+	}
+
+	bool is_hazard(Node* node) const {                                         // Check if any producer currently protects node
+		for (Hazard* hazard = _hazards.load(std::memory_order_acquire); hazard; hazard = hazard->Next)
+			if (hazard->Pointer.load(std::memory_order_seq_cst) == node)
+				return true;
+
+		return false;
+	}
+
+	static void delete_chain(Node* node) {                                     // Deallocate a chain of nodes without destroying data
+		while (node) {
+			Node* next = node->Next.load(std::memory_order_relaxed);
+			delete node;
+			node = next;
+		}
+	}
+};
\ No newline at end of file
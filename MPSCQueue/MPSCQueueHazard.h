@@ -0,0 +1,13 @@
+#pragma once
+#include <atomic>
+
+template<class MPSCQueue>
+struct MPSCQueueHazard                                                           // Hazard pointer record owned by one producer for the duration of a pool pop
+{
+public:
+	using Node = typename MPSCQueue::Node;
+
+	std::atomic<Node*> Pointer = nullptr;                                        // Node that must not be recycled while published here
+	std::atomic<bool> Active = false;                                            // Record is currently owned by a producer
+	MPSCQueueHazard* Next = nullptr;                                             // Reference to next record (records are never removed)
+};
\ No newline at end of file
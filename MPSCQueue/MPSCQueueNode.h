@@ -0,0 +1,16 @@
+#pragma once
+#include <atomic>
+
+template<class MPSCQueue>
+struct MPSCQueueNode                                                             // Struct that holds raw storage for data and an atomic reference to next struct
+{
+public:
+	using ValueType = typename MPSCQueue::ValueType;
+
+	std::atomic<MPSCQueueNode*> Next = nullptr;                                  // Reference to next (in the queue or in the pool)
+	alignas(ValueType) unsigned char Storage[sizeof(ValueType)];                 // Raw memory for data (constructed only while the node is queued)
+
+	ValueType* value() {                                                         // Access data stored in this node
+		return reinterpret_cast<ValueType*>(Storage);
+	}
+};
\ No newline at end of file
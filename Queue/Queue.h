@@ -1,19 +1,22 @@
 #pragma once
+#include <optional>
 #include "QueueNode.h"
+#include "QueueIterator.h"
+#include "../DynamicArray/DynamicArray.h"
 
 template<class Type>
 class Queue
 {
 public:
 	using ValueType = Type;                                                 // Type for stored values
-	using Node = typename QueueNode<Queue<ValueType>>;                      // Node type
+	using Node = QueueNode<Queue<ValueType>>;                               // Node type
+	using ConstIterator = QueueConstIterator<Queue<ValueType>>;             // Const Iterator type (head to tail)
 
 private:
 	size_t _size = 0;                                                       // Number of Nodes held by this
 	Node* _head = nullptr;                                                  // Head of this list
 	Node* _tail = nullptr;                                                  // Tail of this list
 	mutable Node* _workspaceNode = nullptr;                                 // Auxiliary Node for work
-	mutable ValueType _workspaceValue;                                      // Auxiliary Value for work
 
 public:
 	// Constructors
@@ -72,20 +75,125 @@ public:
 		emplace_back(std::move(moveValue));
 	}
 
-	ValueType dequeue() {                                                  // Return first component and remove it from queue
-		if (_head) {
-			_workspaceValue = _head->Value;
-			_workspaceNode = _head;
-			_head = _head->Next;
+	ValueType dequeue() {                                                  // Return first component (moved out) and remove it from queue
+		if (_head == nullptr)
+			throw std::out_of_range("Queue dequeue on empty queue...");
 
-			if (_head == nullptr)
-				_tail = nullptr;
+		ValueType value = std::move(_head->Value);
+		remove_front();
+		return value;
+	}
 
-			delete _workspaceNode;
-			_size--;
+	bool try_dequeue(ValueType& out) {                                     // Move first component into out and remove it, if any
+		if (_head == nullptr)
+			return false;
+
+		out = std::move(_head->Value);
+		remove_front();
+		return true;
+	}
+
+	std::optional<ValueType> pop() {                                       // Return first component (moved out) and remove it, empty if queue is empty
+		if (_head == nullptr)
+			return std::nullopt;
+
+		std::optional<ValueType> value(std::move(_head->Value));
+		remove_front();
+		return value;
+	}
+
+	template<class Function>
+	bool consume(Function&& function) {                                    // Pass first component in place to function, then remove it. False if empty
+		if (_head == nullptr)
+			return false;
+
+		function(_head->Value);                                            // Component stays queued if function throws
+		remove_front();
+		return true;
+	}
 
-			return _workspaceValue;
+	ValueType& front() {                                                   // Get the value of the first component
+		return _head->Value;
+	}
+
+	const ValueType& front() const {                                       // Get the value of the first component (read only)
+		return _head->Value;
+	}
+
+	template<class InputIterator>
+	void enqueue_bulk(InputIterator first, InputIterator last) {           // Add copies of [first, last) to the tail, linking the new nodes in one pass
+		if (first == last)
+			return;
+
+		Node* chainHead = new Node(*first);
+		Node* chainTail = chainHead;
+		size_t count = 1;
+		try {
+			for (++first; first != last; ++first, ++count) {
+				chainTail->Next = new Node(*first);
+				chainTail = chainTail->Next;
+			}
 		}
+		catch (...) {                                                      // Queue unchanged, drop the partial chain
+			delete_chain(chainHead);
+			throw;
+		}
+
+		if (_head == nullptr)
+			_head = chainHead;
+		else
+			_tail->Next = chainHead;
+		_tail = chainTail;
+		_size += count;
+	}
+
+	template<class OutputIterator>
+	size_t dequeue_bulk(OutputIterator out, const size_t& maxCount) {      // Move up to maxCount components into out and remove them, return how many
+		size_t count = 0;
+		Node* chain = detach_front(maxCount, count);
+
+		size_t moved = 0;
+		try {
+			for (; chain; moved++) {
+				*out = std::move(chain->Value);
+				++out;
+
+				_workspaceNode = chain;
+				chain = chain->Next;
+				delete _workspaceNode;
+			}
+		}
+		catch (...) {                                                      // Components not moved yet go back to the head
+			attach_front(chain, count - moved);
+			throw;
+		}
+		return count;
+	}
+
+	size_t dequeue_bulk(DynamicArray<ValueType>& out, const size_t& maxCount) {    // Move up to maxCount components to the end of out (one reserve per batch)
+		size_t count = 0;
+		Node* chain = detach_front(maxCount, count);
+
+		size_t moved = 0;
+		try {
+			size_t needed = out.size() + count;
+			size_t grown = out.capacity() + out.capacity() / 2 + 1;                  // Same 50% growth as push_back, draining in small batches stays linear
+			if (needed > out.capacity())
+				out.reserve(needed > grown ? needed : grown);
+
+			for (; chain; moved++) {
+				out.emplace_back(std::move(chain->Value));
+
+				_workspaceNode = chain;
+				chain = chain->Next;
+				delete _workspaceNode;
+			}
+		}
+		catch (...) {                                                      // Components not moved yet go back to the head
+			attach_front(chain, count - moved);
+			throw;
+		}
+		return count;
 	}
 
 	const size_t size() const {                                          // Get size
@@ -131,6 +239,17 @@ public:
 		return *this;
 	}
 
+public:
+	// Iterator specific functions
+
+	ConstIterator begin() const {
+		return ConstIterator(_head);
+	}
+
+	ConstIterator end() const {
+		return ConstIterator(nullptr);
+	}
+
 private:
 	// Others
 
@@ -146,4 +265,58 @@ private:
 		}
 		_size++;
 	}
+
+	void remove_front() {                                               // Unlink and delete first node
+		_workspaceNode = _head;
+		_head = _head->Next;
+
+		if (_head == nullptr)
+			_tail = nullptr;
+
+		delete _workspaceNode;
+		_size--;
+	}
+
+	Node* detach_front(const size_t& maxCount, size_t& count) {        // Unlink up to maxCount nodes from the head and return them as a chain
+		count = (maxCount < _size) ? maxCount : _size;
+		if (count == 0)
+			return nullptr;
+
+		Node* chain = _head;
+		_workspaceNode = _head;
+		for (size_t i = 1; i < count; i++)
+			_workspaceNode = _workspaceNode->Next;
+
+		_head = _workspaceNode->Next;
+		_workspaceNode->Next = nullptr;
+		if (_head == nullptr)
+			_tail = nullptr;
+
+		_size -= count;
+		return chain;
+	}
+
+	void attach_front(Node* chain, const size_t& count) {               // Link a detached chain of count nodes back before the head
+		if (chain == nullptr)
+			return;
+
+		_workspaceNode = chain;
+		while (_workspaceNode->Next)
+			_workspaceNode = _workspaceNode->Next;
+
+		_workspaceNode->Next = _head;
+		if (_head == nullptr)
+			_tail = _workspaceNode;
+
+		_head = chain;
+		_size += count;
+	}
+
+	void delete_chain(Node* chain) {                                    // Delete a chain of nodes not linked into this queue
+		while (chain) {
+			_workspaceNode = chain;
+			chain = chain->Next;
+			delete _workspaceNode;
+		}
+	}
 };
\ No newline at end of file
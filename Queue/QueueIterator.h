@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+
+template<class Queue>
+class QueueConstIterator                                                 // Forward iterator from head to tail of Queue (read only)
+{
+public:
+	using ValueType = typename Queue::ValueType;
+	using Node = typename Queue::Node;
+
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = ValueType;
+	using difference_type = ptrdiff_t;
+	using pointer = const ValueType*;
+	using reference = const ValueType&;
+
+	Node* NodePtr = nullptr;
+
+public:
+	QueueConstIterator() = default;
+
+	QueueConstIterator(Node* nodePtr)
+		:NodePtr(nodePtr) { }
+
+	QueueConstIterator& operator++() {
+		NodePtr = NodePtr->Next;
+		return *this;
+	}
+
+	QueueConstIterator operator++(int) {
+		QueueConstIterator iterator = *this;
+		NodePtr = NodePtr->Next;
+		return iterator;
+	}
+
+	pointer operator->() const {
+		return &NodePtr->Value;
+	}
+
+	reference operator*() const {
+		return NodePtr->Value;
+	}
+
+	bool operator==(const QueueConstIterator& other) const {
+		return NodePtr == other.NodePtr;
+	}
+};
\ No newline at end of file
@@ -10,15 +10,12 @@ public:
 	QueueNode* Next = nullptr;                                               // Reference to next
 
 	template<class... Args>
-	QueueNode(Args&&... args) {                                              // Add data using emplace type Constructor
-		new(&Value) ValueType(std::forward<Args>(args)...);
-	}
+	QueueNode(Args&&... args)                                                // Add data using emplace type Constructor
+		:Value(std::forward<Args>(args)...) { }
 
-	QueueNode(const ValueType& value) {                                      // Add data using reference type Constructor
-		new(&Value) ValueType(value);
-	}
+	QueueNode(const ValueType& value)                                        // Add data using reference type Constructor
+		:Value(value) { }
 
-	QueueNode(ValueType&& value) {                                           // Add data using temporary type Constructor
-		new(&Value) ValueType(std::move(value));
-	}
+	QueueNode(ValueType&& value)                                             // Add data using temporary type Constructor
+		:Value(std::move(value)) { }
 };
\ No newline at end of file
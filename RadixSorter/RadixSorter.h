@@ -0,0 +1,147 @@
+#pragma once
+#include <algorithm>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "RadixSorterKey.h"
+#include "../DynamicArray/DynamicArray.h"
+
+template<class Type>
+class RadixSorter                                                               // LSD radix sort for DynamicArray, keeps its scratch buffer between sorts
+{
+public:
+	using ValueType = Type;                                                     // Type for sorted values
+
+	static constexpr size_t RadixBits = 8;                                      // Bits consumed per pass
+	static constexpr size_t Buckets = size_t(1) << RadixBits;                   // Buckets per pass
+	static constexpr size_t SmallSize = 256;                                    // Below this size a comparison sort is faster
+	static constexpr size_t ParallelSize = size_t(1) << 20;                     // Minimum size for parallel histograms
+
+private:
+	DynamicArray<ValueType> _scratch;                                           // Destination of odd passes, reused between sorts
+	DynamicArray<size_t> _partials;                                             // Per-thread histograms of parallel sorts, reused between sorts
+	size_t _threadCount = 1;                                                    // Threads used to build histograms
+
+public:
+	// Constructors
+
+	RadixSorter(const size_t& threadCount = 1)                                  // threadCount > 1 builds histograms of large arrays in parallel
+		:_threadCount(threadCount ? threadCount : 1) { }
+
+public:
+	// Main functions
+
+	void sort(DynamicArray<ValueType>& array) {                                 // Sort integral or floating point values ascending
+		sort_by_key(array, [](const ValueType& value) -> const ValueType& { return value; });
+	}
+
+	template<class KeyFunction>
+	void sort_by_key(DynamicArray<ValueType>& array, KeyFunction key) {         // Sort records ascending by key(record), stable
+		using Key = std::remove_cvref_t<decltype(key(array[0]))>;
+		using UnsignedType = typename RadixSorterKey<Key>::UnsignedType;
+		constexpr size_t passCount = (sizeof(UnsignedType) * 8 + RadixBits - 1) / RadixBits;
+
+		auto digits = [&key](const ValueType& value) {
+			return RadixSorterKey<Key>::transform(key(value));
+		};
+
+		size_t size = array.size();
+		if (size < SmallSize) {
+			std::stable_sort(array.begin(), array.end(), [&digits](const ValueType& left, const ValueType& right) {
+				return digits(left) < digits(right);
+			});
+			return;
+		}
+
+		size_t histograms[passCount * Buckets] = {};                           // Counts for every pass (pass * Buckets + digit), built in one read of the input
+		build_histograms<passCount>(array, digits, histograms);
+
+		if (_scratch.size() < size) {
+			if constexpr (std::is_trivially_copyable_v<ValueType>) {           // Every slot is written by the first pass, skip construction and the copy of stale content
+				_scratch.clear();
+				_scratch.resize_for_overwrite(size);
+			}
+			else
+				_scratch.resize(size);
+		}
+
+		DynamicArray<ValueType>* source = &array;
+		DynamicArray<ValueType>* destination = &_scratch;
+		for (size_t pass = 0; pass < passCount; pass++) {
+			size_t* counts = histograms + pass * Buckets;
+			size_t shift = pass * RadixBits;
+
+			if (std::find(counts, counts + Buckets, size) != counts + Buckets)    // Every value has the same digit, nothing moves
+				continue;
+
+			size_t offsets[Buckets];
+			size_t sum = 0;
+			for (size_t bucket = 0; bucket < Buckets; bucket++) {
+				offsets[bucket] = sum;
+				sum += counts[bucket];
+			}
+
+			for (size_t i = 0; i < size; i++) {
+				ValueType& value = (*source)[i];
+				(*destination)[offsets[(digits(value) >> shift) & (Buckets - 1)]++] = std::move(value);
+			}
+
+			std::swap(source, destination);
+		}
+
+		if (source != &array) {                                                 // Odd number of passes: sorted data is in _scratch, exchange storage
+			_scratch.resize(size);                                              // Drop extra slots left from a larger earlier sort
+			array.swap(_scratch);
+		}
+	}
+
+	void release_scratch() {                                                    // Free the buffers kept for later sorts
+		_scratch.clear();
+		_scratch.shrink_to_fit();
+		_partials.clear();
+		_partials.shrink_to_fit();
+	}
+
+private:
+	// Others
+
+	template<size_t PassCount, class DigitFunction>
+	void build_histograms(const DynamicArray<ValueType>& array, DigitFunction& digits, size_t* histograms) {    // Fill PassCount * Buckets counts
+		size_t size = array.size();
+		size_t threadCount = (size >= ParallelSize) ? _threadCount : 1;
+
+		if (threadCount == 1) {
+			count_range<PassCount>(array, digits, 0, size, histograms);
+			return;
+		}
+
+		constexpr size_t histogramSize = PassCount * Buckets;
+		if (_partials.size() < threadCount * histogramSize)
+			_partials.resize(threadCount * histogramSize);
+		std::fill(_partials.data(), _partials.data() + threadCount * histogramSize, size_t(0));    // One flat histogram set per thread, back to back
+
+		DynamicArray<std::thread> threads;
+		threads.reserve(threadCount);
+
+		for (size_t t = 0; t < threadCount; t++)
+			threads.emplace_back([&, t]() {
+				count_range<PassCount>(array, digits, size * t / threadCount, size * (t + 1) / threadCount, _partials.data() + t * histogramSize);
+			});
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		for (size_t t = 0; t < threadCount; t++)
+			for (size_t i = 0; i < histogramSize; i++)
+				histograms[i] += _partials[t * histogramSize + i];
+	}
+
+	template<size_t PassCount, class DigitFunction>
+	static void count_range(const DynamicArray<ValueType>& array, DigitFunction& digits, const size_t& first, const size_t& last, size_t* histograms) {
+		for (size_t i = first; i < last; i++) {
+			auto value = digits(array[i]);
+			for (size_t pass = 0; pass < PassCount; pass++)
+				histograms[pass * Buckets + ((value >> (pass * RadixBits)) & (Buckets - 1))]++;
+		}
+	}
+};
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+template<class Key, class Enable = void>
+struct RadixSorterKey;                                                           // Maps a key to an unsigned integer with the same ordering (defined below per key kind)
+
+template<class Key>
+struct RadixSorterKey<Key, std::enable_if_t<std::is_integral_v<Key> && std::is_unsigned_v<Key>>>    // Unsigned integers sort as they are
+{
+public:
+	using UnsignedType = Key;
+
+	static constexpr UnsignedType transform(const Key& key) {
+		return key;
+	}
+};
+
+template<class Key>
+struct RadixSorterKey<Key, std::enable_if_t<std::is_integral_v<Key> && std::is_signed_v<Key>>>      // Signed integers: flip the sign bit so negatives come first
+{
+public:
+	using UnsignedType = std::make_unsigned_t<Key>;
+
+	static constexpr UnsignedType transform(const Key& key) {
+		return (UnsignedType)key ^ ((UnsignedType)1 << (sizeof(Key) * 8 - 1));
+	}
+};
+
+template<class Key>
+struct RadixSorterKey<Key, std::enable_if_t<std::is_floating_point_v<Key> && (sizeof(Key) == 4 || sizeof(Key) == 8)>>    // IEEE floats: flip all bits of negatives, only the sign bit of positives
+{
+public:
+	using UnsignedType = std::conditional_t<sizeof(Key) == 4, uint32_t, uint64_t>;
+
+	static constexpr UnsignedType transform(const Key& key) {
+		UnsignedType bits = std::bit_cast<UnsignedType>(key);
+		UnsignedType sign = (UnsignedType)1 << (sizeof(Key) * 8 - 1);
+		return (bits & sign) ? ~bits : (bits | sign);
+	}
+};
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+enum class BinaryContainerKind : uint16_t                                       // Container recorded in the header
+{
+	DynamicArray = 1,
+	LinkedList = 2,
+	Queue = 3
+};
+
+struct BinaryHeader                                                             // Fixed-size prefix written before the elements (native byte order)
+{
+public:
+	static constexpr uint32_t CurrentMagic = 0x524E5443;                        // "CTNR" when read back with the same byte order
+	static constexpr uint16_t CurrentVersion = 1;                               // Bumped on any layout change
+
+	uint32_t Magic = CurrentMagic;                                              // Format and byte order check
+	uint16_t Version = CurrentVersion;                                          // Format version
+	uint16_t Kind = 0;                                                          // BinaryContainerKind
+	uint32_t ElementSize = 0;                                                   // sizeof(ValueType) of the writer
+	uint32_t Reserved = 0;                                                      // Explicit padding, always 0
+	uint64_t Count = 0;                                                         // Number of elements following the header
+};
+
+struct BinarySegment                                                            // Contiguous memory range written in one gather batch
+{
+public:
+	const void* Data = nullptr;                                                 // Start of range
+	size_t Size = 0;                                                            // Bytes in range
+};
\ No newline at end of file
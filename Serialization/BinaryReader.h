@@ -0,0 +1,129 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+#include "BinaryFormat.h"
+#include "BinarySource.h"
+#include "../DynamicArray/DynamicArray.h"
+#include "../LinkedList/LinkedList.h"
+#include "../Queue/Queue.h"
+
+template<class Source>
+class BinaryReader                                                              // Reads containers written by BinaryWriter, replacing their content
+{
+public:
+	static constexpr size_t ChunkSize = 1024;                                   // Elements staged per read for node-based containers
+	static constexpr size_t MaxPreallocation = size_t(1) << 24;                 // Bytes allocated ahead of data actually read, when the source length is unknown
+
+private:
+	Source& _source;                                                            // Origin
+
+public:
+	BinaryReader(Source& source)
+		:_source(source) { }
+
+public:
+	// Main functions
+
+	template<class Type>
+	void read(DynamicArray<Type>& array) {                                      // Size storage from the header, then read straight into it. Empty if the read fails
+		static_assert(std::is_trivially_copyable_v<Type>, "BinaryReader needs trivially copyable values");
+
+		array.clear();
+		size_t count = read_header<Type>(BinaryContainerKind::DynamicArray);
+
+		try {
+			size_t done = 0;
+			while (done < count) {                                              // One step when the source length is known, otherwise grow with the data received
+				size_t step = count - done;
+				if constexpr (!HasRemaining) {
+					size_t limit = done > MaxPreallocation / sizeof(Type) ? done : MaxPreallocation / sizeof(Type) + 1;
+					if (step > limit)
+						step = limit;
+				}
+
+				array.resize_for_overwrite(done + step);                        // Bytes come from the source, skip value-initialization
+				_source.read(array.data() + done, step * sizeof(Type));
+				done += step;
+			}
+		}
+		catch (...) {                                                           // Leave no uninitialized elements behind
+			array.clear();
+			throw;
+		}
+	}
+
+	template<class Type>
+	void read(LinkedList<Type>& list) {                                         // Read values in chunks and link a node for each
+		list.clear();
+		size_t count = read_header<Type>(BinaryContainerKind::LinkedList);
+
+		try {
+			read_chunks<Type>(count, [&list](const Type* first, const Type* last) {
+				for (; first != last; ++first)
+					list.push_back(*first);
+			});
+		}
+		catch (...) {
+			list.clear();
+			throw;
+		}
+	}
+
+	template<class Type>
+	void read(Queue<Type>& queue) {                                             // Read values in chunks and link each chunk in one pass
+		queue.clear();
+		size_t count = read_header<Type>(BinaryContainerKind::Queue);
+
+		try {
+			read_chunks<Type>(count, [&queue](const Type* first, const Type* last) {
+				queue.enqueue_bulk(first, last);
+			});
+		}
+		catch (...) {
+			queue.clear();
+			throw;
+		}
+	}
+
+private:
+	// Others
+
+	static constexpr bool HasRemaining = requires(const Source& source) { source.remaining(); };    // Source can tell how many bytes are left
+
+	template<class Type, class Function>
+	void read_chunks(size_t count, Function&& function) {                      // Stage up to ChunkSize elements at a time in one preallocated buffer
+		static_assert(std::is_trivially_copyable_v<Type>, "BinaryReader needs trivially copyable values");
+
+		DynamicArray<Type> chunk;
+		chunk.resize_for_overwrite(count < ChunkSize ? count : ChunkSize);
+
+		while (count > 0) {
+			size_t batch = count < ChunkSize ? count : ChunkSize;
+			_source.read(chunk.data(), batch * sizeof(Type));
+			function(chunk.data(), chunk.data() + batch);
+			count -= batch;
+		}
+	}
+
+	template<class Type>
+	size_t read_header(const BinaryContainerKind& kind) {                       // Read and validate header (count included), return element count
+		BinaryHeader header;
+		_source.read(&header, sizeof(header));
+
+		if (header.Magic != BinaryHeader::CurrentMagic)
+			throw std::runtime_error("Binary header magic mismatch (not a container stream or other byte order)...");
+		if (header.Version != BinaryHeader::CurrentVersion)
+			throw std::runtime_error("Binary header version not supported...");
+		if (header.Kind != (uint16_t)kind)
+			throw std::runtime_error("Binary header container kind mismatch...");
+		if (header.ElementSize != sizeof(Type))
+			throw std::runtime_error("Binary header element size mismatch...");
+		if (header.Count > SIZE_MAX / sizeof(Type))
+			throw std::runtime_error("Binary header count too large...");
+		if constexpr (HasRemaining)
+			if (header.Count * sizeof(Type) > _source.remaining())
+				throw std::runtime_error("Binary header count exceeds the input...");
+
+		return (size_t)header.Count;
+	}
+};
\ No newline at end of file
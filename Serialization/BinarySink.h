@@ -0,0 +1,114 @@
+#pragma once
+#include <cstddef>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include "BinaryFormat.h"
+#include "../DynamicArray/DynamicArray.h"
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+class FileDescriptorSink                                                        // Writes to a file descriptor (write/writev), does not own it
+{
+public:
+	static constexpr size_t MaxSegments = 64;                                   // Segments passed to a single writev
+
+private:
+	int _fd = -1;                                                               // Target descriptor
+
+public:
+	FileDescriptorSink(const int& fd)
+		:_fd(fd) { }
+
+	void write(const void* data, size_t size) {                                 // Write all bytes of [data, data + size)
+		const char* bytes = (const char*)data;
+		while (size > 0) {
+#if defined(_WIN32)
+			int written = ::_write(_fd, bytes, (unsigned int)(size < 0x40000000 ? size : 0x40000000));
+#else
+			ssize_t written = ::write(_fd, bytes, size);
+#endif
+			if (written < 0) {
+				if (errno == EINTR)
+					continue;
+				throw std::runtime_error("Binary write failed...");
+			}
+			bytes += written;
+			size -= (size_t)written;
+		}
+	}
+
+	void write_gather(const BinarySegment* segments, size_t count) {            // Write segments in order, MaxSegments per system call
+#if defined(_WIN32)
+		for (size_t i = 0; i < count; i++)
+			write(segments[i].Data, segments[i].Size);
+#else
+		iovec vectors[MaxSegments];
+		while (count > 0) {
+			size_t batch = count < MaxSegments ? count : MaxSegments;
+			size_t total = 0;
+			for (size_t i = 0; i < batch; i++) {
+				vectors[i].iov_base = (void*)segments[i].Data;
+				vectors[i].iov_len = segments[i].Size;
+				total += segments[i].Size;
+			}
+
+			ssize_t written = ::writev(_fd, vectors, (int)batch);
+			if (written < 0) {
+				if (errno == EINTR)
+					continue;
+				throw std::runtime_error("Binary write failed...");
+			}
+
+			if ((size_t)written < total)                                        // Short write, finish this batch segment by segment
+				for (size_t i = 0; i < batch; i++) {
+					if ((size_t)written >= segments[i].Size) {
+						written -= segments[i].Size;
+						continue;
+					}
+					write((const char*)segments[i].Data + written, segments[i].Size - written);
+					written = 0;
+				}
+
+			segments += batch;
+			count -= batch;
+		}
+#endif
+	}
+};
+
+class MemorySink                                                                // Appends to a byte array owned by the caller
+{
+private:
+	DynamicArray<unsigned char>& _buffer;                                       // Target bytes
+
+public:
+	MemorySink(DynamicArray<unsigned char>& buffer)
+		:_buffer(buffer) { }
+
+	void write(const void* data, const size_t& size) {                          // Append [data, data + size), growing the buffer once
+		size_t offset = _buffer.size();
+		if (offset + size > _buffer.capacity())
+			_buffer.reserve(offset + size + (offset + size) / 2);
+
+		_buffer.resize_for_overwrite(offset + size);
+		std::memcpy(_buffer.data() + offset, data, size);
+	}
+
+	void write_gather(const BinarySegment* segments, const size_t& count) {     // Append segments in order
+		size_t total = 0;
+		for (size_t i = 0; i < count; i++)
+			total += segments[i].Size;
+
+		if (_buffer.size() + total > _buffer.capacity())
+			_buffer.reserve(_buffer.size() + total + (_buffer.size() + total) / 2);
+
+		for (size_t i = 0; i < count; i++)
+			write(segments[i].Data, segments[i].Size);
+	}
+};
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+class FileDescriptorSource                                                      // Reads from a file descriptor straight into the destination, does not own it
+{
+private:
+	int _fd = -1;                                                               // Source descriptor
+
+public:
+	FileDescriptorSource(const int& fd)
+		:_fd(fd) { }
+
+	void read(void* data, size_t size) {                                        // Fill [data, data + size), throw on end of file
+		char* bytes = (char*)data;
+		while (size > 0) {
+#if defined(_WIN32)
+			int received = ::_read(_fd, bytes, (unsigned int)(size < 0x40000000 ? size : 0x40000000));
+#else
+			ssize_t received = ::read(_fd, bytes, size);
+#endif
+			if (received < 0 && errno == EINTR)
+				continue;
+			if (received <= 0)
+				throw std::runtime_error("Binary read failed...");
+
+			bytes += received;
+			size -= (size_t)received;
+		}
+	}
+};
+
+class MemorySource                                                              // Reads from a byte range owned by the caller
+{
+private:
+	const unsigned char* _data = nullptr;                                       // Next byte to read
+	size_t _remaining = 0;                                                      // Bytes left
+
+public:
+	MemorySource(const void* data, const size_t& size)
+		:_data((const unsigned char*)data), _remaining(size) { }
+
+	void read(void* data, const size_t& size) {                                 // Copy next size bytes into data, throw if the range is too short
+		if (size > _remaining)
+			throw std::runtime_error("Binary read past end of buffer...");
+
+		std::memcpy(data, _data, size);
+		_data += size;
+		_remaining -= size;
+	}
+
+	const size_t remaining() const {                                            // Get bytes left
+		return _remaining;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+#include <type_traits>
+#include "BinaryFormat.h"
+#include "BinarySink.h"
+#include "../DynamicArray/DynamicArray.h"
+#include "../LinkedList/LinkedList.h"
+#include "../Queue/Queue.h"
+
+template<class Sink>
+class BinaryWriter                                                              // Writes containers of trivially copyable values as header + raw elements
+{
+public:
+	static constexpr size_t GatherBatch = 64;                                   // Node values gathered per write_gather call
+
+private:
+	Sink& _sink;                                                                // Destination
+
+public:
+	BinaryWriter(Sink& sink)
+		:_sink(sink) { }
+
+public:
+	// Main functions
+
+	template<class Type>
+	void write(const DynamicArray<Type>& array) {                               // Header, then the whole storage in one write
+		static_assert(std::is_trivially_copyable_v<Type>, "BinaryWriter needs trivially copyable values");
+
+		BinaryHeader header = make_header<Type>(BinaryContainerKind::DynamicArray, array.size());
+		BinarySegment segments[2] = { { &header, sizeof(header) }, { array.data(), array.size() * sizeof(Type) } };
+		_sink.write_gather(segments, array.empty() ? 1 : 2);
+	}
+
+	template<class Type>
+	void write(const LinkedList<Type>& list) {                                  // Header, then node values in gather batches
+		write_nodes<Type>(BinaryContainerKind::LinkedList, list.size(), list.begin(), list.end());
+	}
+
+	template<class Type>
+	void write(const Queue<Type>& queue) {                                      // Header, then node values (head to tail) in gather batches
+		write_nodes<Type>(BinaryContainerKind::Queue, queue.size(), queue.begin(), queue.end());
+	}
+
+private:
+	// Others
+
+	template<class Type, class Iterator>
+	void write_nodes(const BinaryContainerKind& kind, const size_t& count, Iterator first, const Iterator& last) {
+		static_assert(std::is_trivially_copyable_v<Type>, "BinaryWriter needs trivially copyable values");
+
+		BinaryHeader header = make_header<Type>(kind, count);
+		BinarySegment segments[GatherBatch];
+		segments[0] = { &header, sizeof(header) };
+		size_t used = 1;
+
+		for (; first != last; ++first) {
+			segments[used++] = { &*first, sizeof(Type) };
+			if (used == GatherBatch) {
+				_sink.write_gather(segments, used);
+				used = 0;
+			}
+		}
+
+		if (used > 0)
+			_sink.write_gather(segments, used);
+	}
+
+	template<class Type>
+	static BinaryHeader make_header(const BinaryContainerKind& kind, const size_t& count) {
+		BinaryHeader header;
+		header.Kind = (uint16_t)kind;
+		header.ElementSize = (uint32_t)sizeof(Type);
+		header.Count = (uint64_t)count;
+		return header;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include "SnapshotArrayVersion.h"
+
+template<class Type>
+class SnapshotArray                                                             // Copy-on-write array: O(1) snapshots, writers copy only the chunks they modify
+{
+public:
+	using ValueType = Type;                                                     // Type for stored values
+	using Version = SnapshotArrayVersion<SnapshotArray<ValueType>>;             // Version type
+	using Snapshot = std::shared_ptr<const Version>;                            // Immutable view held by readers
+
+	static constexpr size_t ChunkSize = 256;                                    // Components per chunk (unit of copying on write)
+
+private:
+	std::atomic<Snapshot> _current;                                             // Published version
+
+public:
+	// Constructors
+
+	SnapshotArray()                                                             // Default Constructor
+		:_current(std::make_shared<const Version>()) { }
+
+	SnapshotArray(const DynamicArray<ValueType>& values)                        // Publish values as the first version
+		:_current(std::make_shared<const Version>(values)) { }
+
+	SnapshotArray(const SnapshotArray&) = delete;
+	SnapshotArray& operator=(const SnapshotArray&) = delete;
+
+public:
+	// Main functions
+
+	Snapshot snapshot() const {                                                 // Get current version, stays valid and unchanged while held
+		return _current.load(std::memory_order_acquire);
+	}
+
+	template<class Function>
+	void update(Function&& function) {                                          // Apply function to a private copy of the current version and publish it
+		Snapshot expected = snapshot();
+		while (true) {
+			std::shared_ptr<Version> next = std::make_shared<Version>(*expected);    // Copies the chunk table only
+			function(*next);
+
+			if (_current.compare_exchange_weak(expected, Snapshot(std::move(next)), std::memory_order_acq_rel, std::memory_order_acquire))
+				return;                                                         // Otherwise another writer won, retry on its version
+		}
+	}
+
+	void publish(Version&& version) {                                           // Replace current version
+		_current.store(std::make_shared<const Version>(std::move(version)), std::memory_order_release);
+	}
+
+	const size_t size() const {                                                 // Get size of current version
+		return snapshot()->size();
+	}
+};
\ No newline at end of file
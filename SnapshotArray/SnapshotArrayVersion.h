@@ -0,0 +1,117 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include "../DynamicArray/DynamicArray.h"
+
+template<class SnapshotArray>
+class SnapshotArrayVersion                                                      // One version of a SnapshotArray: a table of shared fixed-size chunks
+{
+public:
+	using ValueType = typename SnapshotArray::ValueType;
+	using Chunk = DynamicArray<ValueType>;                                      // Chunk type (at most ChunkSize components)
+	using ChunkPtr = std::shared_ptr<const Chunk>;                              // Chunks are shared between versions
+
+	static constexpr size_t ChunkSize = SnapshotArray::ChunkSize;
+
+private:
+	DynamicArray<ChunkPtr> _chunks;                                             // Chunk table, copying it shares every chunk
+	size_t _size = 0;                                                           // Number of components
+
+public:
+	// Constructors
+
+	SnapshotArrayVersion() = default;                                           // Default Constructor
+
+	SnapshotArrayVersion(const DynamicArray<ValueType>& values) {               // Build from array (copies values once)
+		for (const ValueType& value : values)
+			push_back(value);
+	}
+
+public:
+	// Main functions
+
+	const size_t size() const {                                                 // Get size
+		return _size;
+	}
+
+	bool empty() const {                                                        // Check if version is empty
+		return _size == 0;
+	}
+
+	const ValueType& at(const size_t& index) const {                            // Acces object at index with check (read only)
+		if (index >= _size)
+			throw std::out_of_range("Invalid Index...");
+
+		return (*this)[index];
+	}
+
+	void set(const size_t& index, const ValueType& copyValue) {                 // Replace component at index, copying its chunk if shared
+		if (index >= _size)
+			throw std::out_of_range("Invalid Index...");
+
+		mutable_chunk(index / ChunkSize)[index % ChunkSize] = copyValue;
+	}
+
+	void set(const size_t& index, ValueType&& moveValue) {                      // Replace component at index with temporary, copying its chunk if shared
+		if (index >= _size)
+			throw std::out_of_range("Invalid Index...");
+
+		mutable_chunk(index / ChunkSize)[index % ChunkSize] = std::move(moveValue);
+	}
+
+	template<class... Args>
+	void emplace_back(Args&&... args) {                                         // Construct object using arguments (Args) at the end, copying the last chunk if shared
+		if (_size % ChunkSize == 0) {
+			std::shared_ptr<Chunk> newChunk = std::make_shared<Chunk>();
+			newChunk->reserve(ChunkSize);
+			_chunks.push_back(std::move(newChunk));
+		}
+
+		mutable_chunk(_size / ChunkSize).emplace_back(std::forward<Args>(args)...);
+		_size++;
+	}
+
+	void push_back(const ValueType& copyValue) {                                // Add copy at the end
+		emplace_back(copyValue);
+	}
+
+	void push_back(ValueType&& moveValue) {                                     // Add temporary at the end
+		emplace_back(std::move(moveValue));
+	}
+
+	void pop_back() {                                                           // Remove last component
+		if (_size == 0)
+			return;
+
+		_size--;
+		if (_size % ChunkSize == 0)
+			_chunks.pop_back();
+		else
+			mutable_chunk(_size / ChunkSize).pop_back();
+	}
+
+	const size_t chunk_count() const {                                          // Get number of chunks
+		return _chunks.size();
+	}
+
+public:
+	// Operators
+
+	const ValueType& operator[](const size_t& index) const {                    // Acces object at index (read only)
+		return (*_chunks[index / ChunkSize])[index % ChunkSize];
+	}
+
+private:
+	// Others
+
+	Chunk& mutable_chunk(const size_t& chunkIndex) {                           // Get chunk for writing, copying it first unless this version is its only owner
+		ChunkPtr& chunk = _chunks[chunkIndex];
+		if (chunk.use_count() != 1)
+			chunk = std::make_shared<Chunk>(*chunk);                            // Copy keeps the ChunkSize capacity
+		else
+			std::atomic_thread_fence(std::memory_order_acquire);                // use_count() is a relaxed load, pair with the release decrement of the last other owner before writing
+
+		return const_cast<Chunk&>(*chunk);                                      // Every chunk is created non-const by make_shared<Chunk>
+	}
+};
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+#include <atomic>
+#include <exception>
+#include <thread>
+#include "TaskScheduler.h"
+
+class TaskGroup                                                                 // Set of tasks forked together and joined with wait()
+{
+private:
+	TaskScheduler& _scheduler;                                                  // Scheduler executing the tasks
+	TaskScheduler::Completion _completion;                                      // Spawned tasks not finished yet and the first exception thrown
+
+public:
+	// Constructors
+
+	TaskGroup(TaskScheduler& scheduler)
+		:_scheduler(scheduler) { }
+
+	TaskGroup(const TaskGroup&) = delete;
+	TaskGroup& operator=(const TaskGroup&) = delete;
+
+	~TaskGroup() {                                                              // Destructor (tasks reference this group, so join them, an unobserved exception is dropped)
+		join();
+	}
+
+public:
+	// Main functions
+
+	template<class Function>
+	void spawn(Function&& function) {                                           // Fork: make function available to any worker
+		TaskScheduler::Task* task = new TaskScheduler::Task(std::function<void()>(std::forward<Function>(function)), &_completion);
+		_completion.Pending.fetch_add(1, std::memory_order_relaxed);
+		_scheduler.submit(task);
+	}
+
+	void wait() {                                                               // Join: help run tasks until every spawned task finished, rethrow the first exception
+		join();
+
+		if (_completion.Failed.load(std::memory_order_relaxed)) {
+			std::exception_ptr exception = std::move(_completion.Exception);
+			_completion.Exception = nullptr;
+			_completion.Failed.store(false, std::memory_order_relaxed);
+			std::rethrow_exception(exception);
+		}
+	}
+
+private:
+	// Others
+
+	void join() {                                                               // Help run tasks until every spawned task finished
+		while (_completion.Pending.load(std::memory_order_acquire) != 0)
+			if (!_scheduler.run_one())
+				std::this_thread::yield();
+	}
+};
\ No newline at end of file
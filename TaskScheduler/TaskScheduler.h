@@ -0,0 +1,156 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "TaskSchedulerTask.h"
+#include "../WorkStealingDeque/WorkStealingDeque.h"
+#include "../MPMCQueue/MPMCQueue.h"
+#include "../DynamicArray/DynamicArray.h"
+
+class TaskScheduler                                                             // Fork-join scheduler: one work-stealing deque per worker, randomized stealing
+{
+public:
+	using Task = TaskSchedulerTask;                                             // Task type
+	using Completion = TaskSchedulerCompletion;                                 // Completion type shared by the tasks of a group
+
+	static constexpr size_t InjectionCapacity = 1024;                           // Slots for tasks submitted by threads outside the pool
+
+private:
+	struct Worker                                                               // Per-thread state
+	{
+		TaskScheduler* Scheduler = nullptr;                                     // Owning scheduler
+		WorkStealingDeque<Task*> Deque;                                         // Tasks spawned by this worker
+		size_t Seed = 0;                                                        // xorshift state used to pick victims
+		std::thread Thread;                                                     // OS thread running worker_loop
+	};
+
+	inline static thread_local Worker* _currentWorker = nullptr;                // Worker of the calling thread, nullptr outside any pool
+
+	DynamicArray<Worker*> _workers;                                             // All workers of this pool
+	MPMCQueue<Task*> _injection;                                                // Tasks submitted from outside the pool
+	std::atomic<bool> _stopping = false;                                        // Set by the destructor to end worker loops
+
+public:
+	// Constructors
+
+	TaskScheduler(const size_t& threadCount = std::thread::hardware_concurrency())
+		:_injection(InjectionCapacity) {
+		size_t count = threadCount ? threadCount : 1;
+		_workers.reserve(count);
+
+		for (size_t i = 0; i < count; i++) {
+			Worker* worker = new Worker();
+			worker->Scheduler = this;
+			worker->Seed = 0x9E3779B97F4A7C15ull * (i + 1);
+			_workers.push_back(worker);
+		}
+
+		for (Worker* worker : _workers)                                         // Start only once every deque exists, threads steal from each other
+			worker->Thread = std::thread(&TaskScheduler::worker_loop, this, worker);
+	}
+
+	TaskScheduler(const TaskScheduler&) = delete;
+	TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+	~TaskScheduler() {                                                          // Destructor (pending tasks are discarded)
+		_stopping.store(true, std::memory_order_release);
+		for (Worker* worker : _workers)
+			worker->Thread.join();
+
+		Task* task;
+		for (Worker* worker : _workers) {
+			while (worker->Deque.pop(task))
+				delete task;
+			delete worker;
+		}
+		while (_injection.try_dequeue(task))
+			delete task;
+	}
+
+public:
+	// Main functions
+
+	void submit(Task* task) {                                                   // Push to own deque when called by a worker, otherwise to the injection queue
+		Worker* worker = _currentWorker;
+		if (worker != nullptr && worker->Scheduler == this)
+			worker->Deque.push(task);
+		else
+			_injection.enqueue(task);
+	}
+
+	bool run_one() {                                                            // Execute one available task on the calling thread, false if none was found
+		Task* task = find_task();
+		if (task == nullptr)
+			return false;
+
+		execute(task);
+		return true;
+	}
+
+	const size_t thread_count() const {                                         // Get number of workers
+		return _workers.size();
+	}
+
+private:
+	// Others
+
+	void worker_loop(Worker* worker) {                                          // Run tasks until the scheduler stops, backing off when idle
+		_currentWorker = worker;
+
+		size_t idle = 0;
+		while (!_stopping.load(std::memory_order_acquire)) {
+			if (run_one())
+				idle = 0;
+			else if (++idle < 64)
+				std::this_thread::yield();
+			else
+				std::this_thread::sleep_for(std::chrono::microseconds(50));
+		}
+
+		_currentWorker = nullptr;
+	}
+
+	Task* find_task() {                                                         // Local deque first, then random victims, then the injection queue
+		Task* task = nullptr;
+		Worker* self = _currentWorker;
+		if (self != nullptr && self->Scheduler != this)
+			self = nullptr;
+
+		if (self != nullptr && self->Deque.pop(task))
+			return task;
+
+		size_t count = _workers.size();
+		size_t start = self ? next_random(self->Seed) : (size_t)std::hash<std::thread::id>()(std::this_thread::get_id());
+		for (size_t i = 0; i < count; i++) {
+			Worker* victim = _workers[(start + i) % count];
+			if (victim != self && victim->Deque.steal(task))
+				return task;
+		}
+
+		if (_injection.try_dequeue(task))
+			return task;
+
+		return nullptr;
+	}
+
+	static void execute(Task* task) {                                           // Run task, report completion (and the first exception) and free it
+		TaskSchedulerCompletion* completion = task->Completion;
+		try {
+			task->Function();
+		}
+		catch (...) {                                                           // Never let it reach worker_loop, wait() rethrows it
+			if (!completion->Failed.exchange(true, std::memory_order_relaxed))
+				completion->Exception = std::current_exception();
+		}
+
+		delete task;
+		completion->Pending.fetch_sub(1, std::memory_order_release);           // Last access, the group may be gone after this
+	}
+
+	static size_t next_random(size_t& seed) {                                   // xorshift64
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		return seed;
+	}
+};
\ No newline at end of file
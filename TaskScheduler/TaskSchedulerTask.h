@@ -0,0 +1,22 @@
+#pragma once
+#include <atomic>
+#include <exception>
+#include <functional>
+
+struct TaskSchedulerCompletion                                                  // Struct that tracks the tasks of one group and the first exception they threw
+{
+public:
+	std::atomic<size_t> Pending = 0;                                            // Tasks not finished yet
+	std::atomic<bool> Failed = false;                                           // Set by the first task that throws
+	std::exception_ptr Exception;                                               // Written once by that task, read after Pending reaches 0
+};
+
+struct TaskSchedulerTask                                                         // Struct that holds a unit of work and the completion it reports to
+{
+public:
+	std::function<void()> Function;                                              // Work to run
+	TaskSchedulerCompletion* Completion = nullptr;                               // Completion of the owning group, updated after Function returns or throws
+
+	TaskSchedulerTask(std::function<void()>&& function, TaskSchedulerCompletion* completion)
+		:Function(std::move(function)), Completion(completion) { }
+};
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "BlockingQueue/BlockingQueue.h"
+#include "TestCheck.h"
+
+struct DetachedTask                                                             // Minimal fire-and-forget coroutine, runs until its first suspension right away
+{
+	struct promise_type
+	{
+		DetachedTask get_return_object() { return {}; }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() { }
+		void unhandled_exception() { std::terminate(); }
+	};
+};
+
+static void test_bounded_producers_consumers() {                               // Every item popped exactly once, size never above capacity
+	constexpr int Producers = 4;
+	constexpr int Consumers = 4;
+	constexpr int Items = 20000;
+
+	BlockingQueue<int> queue(8);
+	std::vector<std::atomic<int>> seen(Producers * Items);
+	std::vector<std::thread> threads;
+
+	for (int p = 0; p < Producers; p++)
+		threads.emplace_back([&queue, p]() {
+			for (int i = 0; i < Items; i++)
+				queue.push(p * Items + i);
+		});
+
+	for (int c = 0; c < Consumers; c++)
+		threads.emplace_back([&queue, &seen]() {
+			int value;
+			while (queue.pop(value)) {
+				TEST_CHECK(queue.size() <= queue.capacity());
+				seen[value].fetch_add(1, std::memory_order_relaxed);
+			}
+		});
+
+	for (int p = 0; p < Producers; p++)
+		threads[p].join();
+	queue.close();
+	for (int c = 0; c < Consumers; c++)
+		threads[Producers + c].join();
+
+	for (std::atomic<int>& count : seen)
+		TEST_CHECK(count.load() == 1);
+}
+
+static void test_timeouts() {
+	BlockingQueue<int> queue;
+	int value = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	TEST_CHECK(!queue.try_pop_for(value, std::chrono::milliseconds(20)));
+	TEST_CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+
+	std::thread producer([&queue]() {                                          // A max timeout must not overflow into an expired deadline
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		queue.push(7);
+	});
+	TEST_CHECK(queue.try_pop_for(value, std::chrono::hours::max()));
+	TEST_CHECK(value == 7);
+	producer.join();
+
+	std::thread closer([&queue]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		queue.close();
+	});
+	TEST_CHECK(!queue.try_pop_for(value, std::chrono::nanoseconds::max()));
+	closer.join();
+	TEST_CHECK(!queue.push(1));
+}
+
+static DetachedTask consume(BlockingQueue<int>& queue, std::vector<int>& out) {
+	while (std::optional<int> value = co_await queue.pop())
+		out.push_back(*value);
+}
+
+static void test_coroutine_pop() {                                             // Producer hands values to the suspended coroutine, close ends it
+	BlockingQueue<int> queue;
+	std::vector<int> out;
+
+	queue.push(1);
+	consume(queue, out);
+	TEST_CHECK(out.size() == 1);
+
+	queue.push(2);
+	queue.push(3);
+	TEST_CHECK(out.size() == 3 && out[1] == 2 && out[2] == 3);
+
+	queue.close();
+	queue.push(4);
+	TEST_CHECK(out.size() == 3);
+}
+
+struct ThrowingCopy                                                             // Copy throws while armed
+{
+	static inline bool Armed = false;
+	int Value = 0;
+
+	ThrowingCopy(int value) : Value(value) { }
+	ThrowingCopy(const ThrowingCopy& other) : Value(other.Value) {
+		if (Armed)
+			throw std::runtime_error("copy");
+	}
+	ThrowingCopy(ThrowingCopy&& other) noexcept : Value(other.Value) { }
+	ThrowingCopy& operator=(ThrowingCopy&& other) noexcept { Value = other.Value; return *this; }
+};
+
+static bool push_throws(BlockingQueue<ThrowingCopy>& queue, const ThrowingCopy& value) {
+	ThrowingCopy::Armed = true;
+	bool thrown = false;
+	try {
+		queue.push(value);
+	}
+	catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	ThrowingCopy::Armed = false;
+	return thrown;
+}
+
+static DetachedTask consume_one(BlockingQueue<ThrowingCopy>& queue, std::optional<int>& out, bool& resumed) {
+	std::optional<ThrowingCopy> value = co_await queue.pop();
+	if (value)
+		out = value->Value;
+	resumed = true;
+}
+
+static void test_throwing_push() {                                             // A throwing constructor releases the lock and keeps waiting coroutines linked
+	BlockingQueue<ThrowingCopy> queue(4);
+	ThrowingCopy value(5);
+
+	TEST_CHECK(push_throws(queue, value));
+	TEST_CHECK(queue.push(value) && queue.size() == 1);
+
+	ThrowingCopy popped(0);
+	TEST_CHECK(queue.try_pop(popped) && popped.Value == 5);
+
+	std::optional<int> handed;
+	bool resumed = false;
+	consume_one(queue, handed, resumed);
+	TEST_CHECK(!resumed);
+
+	TEST_CHECK(push_throws(queue, value));
+	TEST_CHECK(!resumed);
+	TEST_CHECK(queue.push(ThrowingCopy(6)));
+	TEST_CHECK(resumed && handed == 6);
+
+	std::optional<int> dropped;
+	bool closedResumed = false;
+	consume_one(queue, dropped, closedResumed);
+	TEST_CHECK(push_throws(queue, value));
+	queue.close();
+	TEST_CHECK(closedResumed && !dropped.has_value());
+}
+
+int main() {
+	test_bounded_producers_consumers();
+	test_timeouts();
+	test_coroutine_pop();
+	test_throwing_push();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "ConcurrentArray/ConcurrentArray.h"
+#include "TestCheck.h"
+
+static void test_concurrent_appends() {                                        // Every append lands once with its value, readers only see published slots
+	constexpr size_t Writers = 8;
+	constexpr size_t Items = 20000;
+
+	ConcurrentArray<size_t> array;
+	std::atomic<bool> done = false;
+	std::vector<std::thread> threads;
+
+	threads.emplace_back([&]() {
+		while (!done.load(std::memory_order_acquire)) {
+			size_t size = array.size();
+			for (size_t i = 0; i < size; i += 97)
+				if (array.is_published(i))
+					TEST_CHECK(array[i] < Writers * Items);
+		}
+	});
+
+	for (size_t w = 0; w < Writers; w++)
+		threads.emplace_back([&array, w]() {
+			for (size_t i = 0; i < Items; i++)
+				if (i % 10 == 0)
+					array.grow_by(3, w * Items + i);
+				else
+					array.push_back(w * Items + i);
+		});
+
+	for (size_t t = 1; t < threads.size(); t++)
+		threads[t].join();
+	done.store(true, std::memory_order_release);
+	threads[0].join();
+
+	std::vector<int> seen(Writers * Items);
+	TEST_CHECK(array.size() == Writers * Items / 10 * 12);
+	for (size_t i = 0; i < array.size(); i++) {
+		TEST_CHECK(array.is_published(i));
+		seen[array.at(i)]++;
+	}
+	for (size_t i = 0; i < seen.size(); i++)
+		TEST_CHECK(seen[i] == (i % 10 == 0 ? 3 : 1));
+}
+
+struct ThrowOnNegative
+{
+	int Value;
+	ThrowOnNegative(int value) : Value(value) {
+		if (value < 0)
+			throw std::runtime_error("negative");
+	}
+};
+
+static void test_throwing_grow_by() {                                          // A failed range leaves later writers able to append
+	ConcurrentArray<ThrowOnNegative> array;
+	for (int i = 0; i < 30; i++)
+		array.emplace_back(i);
+
+	bool thrown = false;
+	try {
+		array.grow_by(5, -1);                                                  // Indices 30..34, crosses into segment 1 (index 32)
+	}
+	catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	TEST_CHECK(thrown);
+
+	size_t index = array.emplace_back(35);
+	TEST_CHECK(index == 35 && array.at(35).Value == 35);
+	TEST_CHECK(!array.is_published(32));
+}
+
+int main() {
+	test_concurrent_appends();
+	test_throwing_grow_by();
+	return 0;
+}
\ No newline at end of file
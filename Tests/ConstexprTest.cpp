@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <array>
+#include "DynamicArray/DynamicArray.h"
+#include "DynamicArray/DynamicArrayFreeze.h"
+#include "TestCheck.h"
+
+// Everything here is checked during compilation; the test binary only has to build.
+
+constexpr bool build_and_grow() {
+	DynamicArray<int> array;
+	for (int i = 0; i < 100; i++)                                               // Several reallocations
+		array.push_back(i * i);
+	array.emplace_back(-1);
+
+	array.resize(105, 7);
+	array.reserve(200);
+	array.shrink_to_fit();
+
+	return array.size() == 105 && array.capacity() == 105 && array[99] == 99 * 99 && array[100] == -1 && array[104] == 7;
+}
+
+constexpr bool copy_and_move() {
+	DynamicArray<int> original(4, 3);
+	DynamicArray<int> copy = original;
+	copy[0] = 9;
+
+	DynamicArray<int> moved = std::move(copy);
+	DynamicArray<int> assigned;
+	assigned = moved;
+	assigned.swap(original);
+
+	return original[0] == 9 && assigned[0] == 3 && moved.size() == 4 && original.size() == 4;
+}
+
+constexpr bool push_and_pop() {
+	DynamicArray<int> array;
+	for (int i = 0; i < 5; i++)
+		array.push_back(i);
+
+	array.push(array.begin() + 2, 42);                                          // 0 1 42 2 3 4
+	array.pop(array.begin());                                                   // 1 42 2 3 4
+	array.pop_back();                                                           // 1 42 2 3
+
+	return array.size() == 4 && array[0] == 1 && array[1] == 42 && array[3] == 3;
+}
+
+constexpr bool sort_and_search() {
+	DynamicArray<int> array;
+	for (int value : { 8, -2, 5, 5, 0, 13, 1 })
+		array.push_back(value);
+
+	std::sort(array.begin(), array.end());
+	return std::is_sorted(array.begin(), array.end()) && *std::lower_bound(array.begin(), array.end(), 4) == 5 && array[0] == -2;
+}
+
+static_assert(build_and_grow());
+static_assert(copy_and_move());
+static_assert(push_and_pop());
+static_assert(sort_and_search());
+
+static constexpr auto Squares = freeze_array<[] {
+	DynamicArray<int> squares;
+	for (int i = 0; i < 16; i++)
+		squares.push_back(i * i);
+	return squares;
+}>();
+
+static_assert(std::is_same_v<decltype(Squares), const std::array<int, 16>>);
+static_assert(Squares[0] == 0 && Squares[5] == 25 && Squares[15] == 225);
+
+int main() {
+	TEST_CHECK(Squares[7] == 49);                                               // The frozen table is usable at run time too
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <vector>
+#include "DynamicArray/DynamicArray.h"
+#include "LinkedList/LinkedList.h"
+#include "TestCheck.h"
+
+static_assert(std::contiguous_iterator<DynamicArray<int>::Iterator>);
+static_assert(std::contiguous_iterator<DynamicArray<int>::ConstIterator>);
+static_assert(std::bidirectional_iterator<LinkedList<int>::Iterator>);
+static_assert(std::bidirectional_iterator<LinkedList<int>::ConstIterator>);
+static_assert(std::ranges::contiguous_range<DynamicArray<int>>);
+static_assert(std::ranges::contiguous_range<const DynamicArray<int>>);
+static_assert(std::ranges::bidirectional_range<LinkedList<int>>);
+static_assert(std::ranges::bidirectional_range<const LinkedList<int>>);
+
+static int sum(std::span<const int> values) {                                  // Takes DynamicArray through the implicit conversion
+	return std::accumulate(values.begin(), values.end(), 0);
+}
+
+static void test_dynamic_array_algorithms() {
+	DynamicArray<int> array;
+	for (int value : { 5, 3, 9, 1, 7, 3 })
+		array.push_back(value);
+
+	TEST_CHECK(sum(array) == 28);
+	std::span<int> writable = array;
+	writable[0] = 6;
+	TEST_CHECK(array[0] == 6 && std::to_address(array.begin()) == array.data());
+
+	std::sort(array.begin(), array.end());
+	TEST_CHECK(std::is_sorted(array.begin(), array.end()));
+	TEST_CHECK(*std::lower_bound(array.begin(), array.end(), 4) == 6);
+	TEST_CHECK(std::lower_bound(array.begin(), array.end(), 4) - array.begin() == 3);
+
+	std::ranges::sort(array, std::ranges::greater());
+	TEST_CHECK(array[0] == 9 && array[array.size() - 1] == 1);
+
+	const DynamicArray<int>& constArray = array;
+	TEST_CHECK(std::ranges::find(constArray, 7) - constArray.begin() == 1);
+	TEST_CHECK(constArray.end() - constArray.begin() == 6);
+}
+
+static void test_linked_list_algorithms() {
+	LinkedList<int> list;
+	for (int value = 1; value <= 5; value++)
+		list.push_back(value);
+
+	std::ranges::reverse(list);
+	std::vector<int> values(list.begin(), list.end());
+	TEST_CHECK((values == std::vector<int>{ 5, 4, 3, 2, 1 }));
+
+	const LinkedList<int>& constList = list;
+	TEST_CHECK(*std::prev(constList.end()) == 1);
+	TEST_CHECK(std::ranges::distance(constList) == 5);
+}
+
+int main() {
+	test_dynamic_array_algorithms();
+	test_linked_list_algorithms();
+	return 0;
+}
\ No newline at end of file
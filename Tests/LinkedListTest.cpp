@@ -0,0 +1,83 @@
+#include <memory>
+#include <string>
+#include "LinkedList/LinkedList.h"
+#include "TestCheck.h"
+
+struct NoDefault                                                                // Move-only, not default constructible
+{
+	std::unique_ptr<int> Value;
+	explicit NoDefault(int value) : Value(new int(value)) { }
+};
+
+struct Counted                                                                  // Counts live instances
+{
+	static inline int Live = 0;
+	int Value = 0;
+
+	Counted(int value) : Value(value) { Live++; }
+	Counted(const Counted& other) : Value(other.Value) { Live++; }
+	~Counted() { Live--; }
+};
+
+static void test_no_default_constructor() {                                    // Sentinels never construct a value
+	LinkedList<NoDefault> list;
+	for (int i = 0; i < 5; i++)
+		list.emplace_back(i);
+
+	TEST_CHECK(*list.extract_front().Value == 0);
+	TEST_CHECK(*list.extract_back().Value == 4);
+	TEST_CHECK(list.size() == 3);
+
+	auto [value, next] = list.extract(list.begin());                           // Temporary iterator is accepted
+	TEST_CHECK(*value.Value == 1);
+	TEST_CHECK(*next->Value == 2);
+
+	auto [last, end] = list.extract(++list.begin());
+	TEST_CHECK(*last.Value == 3);
+	TEST_CHECK(end == list.end() && list.size() == 1);
+}
+
+static void test_extract_while_iterating() {
+	LinkedList<std::string> list;
+	list.push_back("a");
+	list.push_back("b");
+	list.push_back("c");
+
+	std::string joined;
+	for (auto iterator = list.begin(); iterator != list.end(); ) {
+		auto [value, next] = list.extract(iterator);
+		joined += value;
+		iterator = next;
+	}
+	TEST_CHECK(joined == "abc" && list.empty());
+}
+
+static void test_copy_and_lifetime() {                                         // Copies start at the first element, every value is destroyed once
+	{
+		LinkedList<Counted> list;
+		for (int i = 0; i < 4; i++)
+			list.emplace_back(i);
+
+		LinkedList<Counted> copy(list);
+		TEST_CHECK(copy.size() == 4 && copy.front().Value == 0 && copy.back().Value == 3);
+
+		LinkedList<Counted> assigned;
+		assigned.emplace_back(9);
+		assigned = copy;
+		TEST_CHECK(assigned.size() == 4 && assigned.front().Value == 0);
+
+		LinkedList<Counted> moved(std::move(assigned));
+		TEST_CHECK(moved.size() == 4 && moved.back().Value == 3);
+
+		moved.pop(moved.at(1));
+		TEST_CHECK(moved.size() == 3 && moved.at(1)->Value == 2);
+	}
+	TEST_CHECK(Counted::Live == 0);
+}
+
+int main() {
+	test_no_default_constructor();
+	test_extract_while_iterating();
+	test_copy_and_lifetime();
+	return 0;
+}
\ No newline at end of file
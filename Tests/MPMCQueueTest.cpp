@@ -0,0 +1,138 @@
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "MPMCQueue/MPMCQueue.h"
+#include "TestCheck.h"
+
+static void test_sequential_model() {                                          // Every operation agrees with a bounded std::deque
+	MPMCQueue<int> queue(8);
+	std::deque<int> model;
+	std::mt19937 random(1);
+
+	for (int i = 0; i < 100000; i++) {
+		if (random() % 2) {
+			bool pushed = queue.try_enqueue(i);
+			TEST_CHECK(pushed == (model.size() < queue.capacity()));
+			if (pushed)
+				model.push_back(i);
+		}
+		else {
+			int value = -1;
+			bool popped = queue.try_dequeue(value);
+			TEST_CHECK(popped == !model.empty());
+			if (popped) {
+				TEST_CHECK(value == model.front());
+				model.pop_front();
+			}
+		}
+		TEST_CHECK(queue.size() == model.size());
+	}
+}
+
+static void test_concurrent_order() {                                           // Exactly-once delivery and per-producer FIFO as seen by each consumer
+	constexpr size_t Producers = 4;
+	constexpr size_t Consumers = 4;
+	constexpr uint64_t Items = 20000;
+
+	MPMCQueue<uint64_t> queue(64);
+	std::vector<std::atomic<uint32_t>> seen(Producers * Items);
+	std::atomic<uint64_t> consumed = 0;
+	std::atomic<bool> ordered = true;
+	std::vector<std::thread> threads;
+
+	for (uint64_t p = 0; p < Producers; p++)
+		threads.emplace_back([&, p]() {
+			for (uint64_t i = 0; i < Items; i++)
+				queue.enqueue((p << 32) | i);
+		});
+
+	for (size_t c = 0; c < Consumers; c++)
+		threads.emplace_back([&]() {
+			std::vector<int64_t> last(Producers, -1);
+			uint64_t value;
+			while (consumed.load(std::memory_order_relaxed) < Producers * Items) {
+				if (!queue.try_dequeue(value)) {
+					std::this_thread::yield();
+					continue;
+				}
+
+				uint64_t producer = value >> 32;
+				int64_t index = (int64_t)(value & 0xFFFFFFFF);
+				if (index <= last[producer])
+					ordered = false;
+				last[producer] = index;
+
+				seen[producer * Items + index].fetch_add(1, std::memory_order_relaxed);
+				consumed.fetch_add(1, std::memory_order_relaxed);
+			}
+		});
+
+	for (std::thread& thread : threads)
+		thread.join();
+
+	TEST_CHECK(ordered);
+	TEST_CHECK(queue.empty());
+	for (std::atomic<uint32_t>& count : seen)
+		TEST_CHECK(count.load() == 1);
+}
+
+struct ThrowingCopy                                                             // Copy constructor throws on demand, move is nothrow
+{
+	static inline bool Throw = false;
+	int Value = 0;
+
+	ThrowingCopy(int value) : Value(value) { }
+	ThrowingCopy(const ThrowingCopy& other) : Value(other.Value) {
+		if (Throw)
+			throw std::runtime_error("copy");
+	}
+	ThrowingCopy(ThrowingCopy&&) noexcept = default;
+	ThrowingCopy& operator=(ThrowingCopy&&) noexcept = default;
+};
+
+static void test_throwing_constructor() {                                      // A failed construction must not leave a claimed cell behind
+	MPMCQueue<ThrowingCopy> queue(4);
+	ThrowingCopy value(1);
+
+	ThrowingCopy::Throw = true;
+	bool thrown = false;
+	try {
+		queue.try_enqueue(value);
+	}
+	catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	ThrowingCopy::Throw = false;
+
+	TEST_CHECK(thrown);
+	TEST_CHECK(queue.empty());
+	TEST_CHECK(queue.try_enqueue(ThrowingCopy(2)));
+
+	ThrowingCopy out(0);
+	TEST_CHECK(queue.try_dequeue(out) && out.Value == 2);
+}
+
+static void test_move_only() {
+	MPMCQueue<std::unique_ptr<int>> queue(2);
+	TEST_CHECK(queue.try_enqueue(std::make_unique<int>(7)));
+	TEST_CHECK(queue.try_emplace(new int(8)));
+	TEST_CHECK(!queue.try_emplace(nullptr));
+
+	std::unique_ptr<int> out;
+	queue.dequeue(out);
+	TEST_CHECK(*out == 7);
+	queue.dequeue(out);
+	TEST_CHECK(*out == 8);
+}
+
+int main() {
+	test_sequential_model();
+	test_concurrent_order();
+	test_throwing_constructor();
+	test_move_only();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include "MPSCQueue/MPSCQueue.h"
+#include "TestCheck.h"
+
+// Build with -DCONTAINERS_SANITIZER=thread to run this under ThreadSanitizer (see CMakeLists.txt).
+
+static std::atomic<size_t> Allocations = 0;                                     // Calls to global operator new
+
+void* operator new(size_t size) {
+	Allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* memory = std::malloc(size ? size : 1))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+	std::free(memory);
+}
+
+static void test_producers_one_consumer() {                                    // No item lost, each producer's items arrive in order
+	constexpr uint64_t Producers = 4;
+	constexpr uint64_t Items = 20000;
+
+	MPSCQueue<uint64_t> queue;
+	std::vector<std::thread> producers;
+	for (uint64_t p = 0; p < Producers; p++)
+		producers.emplace_back([&queue, p]() {
+			for (uint64_t i = 0; i < Items; i++)
+				queue.enqueue((p << 32) | i);
+		});
+
+	std::vector<uint64_t> next(Producers, 0);
+	uint64_t received = 0;
+	uint64_t value;
+	while (received < Producers * Items) {
+		if (!queue.try_dequeue(value)) {
+			std::this_thread::yield();
+			continue;
+		}
+
+		uint64_t producer = value >> 32;
+		TEST_CHECK(producer < Producers);
+		TEST_CHECK((value & 0xFFFFFFFF) == next[producer]);
+		next[producer]++;
+		received++;
+	}
+
+	for (std::thread& producer : producers)
+		producer.join();
+
+	TEST_CHECK(queue.empty());
+	TEST_CHECK(!queue.try_dequeue(value));
+}
+
+static void test_pool_reuse() {                                                 // Once the pool is primed, a steady enqueue/dequeue cycle allocates nothing
+	constexpr size_t Threshold = MPSCQueue<int>::RetireThreshold;
+
+	MPSCQueue<int> queue;
+	int value;
+	for (size_t i = 0; i < 2 * Threshold; i++) {
+		queue.enqueue((int)i);
+		TEST_CHECK(queue.try_dequeue(value) && value == (int)i);
+	}
+
+	size_t before = Allocations.load();
+	for (size_t i = 0; i < 20 * Threshold; i++) {
+		queue.enqueue((int)i);
+		TEST_CHECK(queue.try_dequeue(value) && value == (int)i);
+	}
+	TEST_CHECK(Allocations.load() - before <= Threshold);
+}
+
+static void test_values_destroyed() {                                           // Values left in the queue are destroyed with it
+	std::shared_ptr<int> counter = std::make_shared<int>(0);
+	{
+		MPSCQueue<std::shared_ptr<int>> queue;
+		for (int i = 0; i < 3 * (int)MPSCQueue<int>::RetireThreshold; i++)
+			queue.enqueue(counter);
+
+		std::shared_ptr<int> out;
+		for (int i = 0; i < (int)MPSCQueue<int>::RetireThreshold; i++)
+			TEST_CHECK(queue.try_dequeue(out));
+		out.reset();
+	}
+	TEST_CHECK(counter.use_count() == 1);
+}
+
+static void test_move_only() {
+	MPSCQueue<std::unique_ptr<std::string>> queue;
+	queue.enqueue(std::make_unique<std::string>("a"));
+	queue.emplace(new std::string("b"));
+
+	std::unique_ptr<std::string> out;
+	TEST_CHECK(queue.try_dequeue(out) && *out == "a");
+	TEST_CHECK(queue.try_dequeue(out) && *out == "b");
+	TEST_CHECK(!queue.try_dequeue(out));
+}
+
+struct ConstructionFailed { };                                                  // Thrown without allocating, so Allocations only counts nodes
+
+struct ThrowingValue                                                            // Constructor throws when asked to
+{
+	int Value = 0;
+
+	ThrowingValue() = default;
+
+	ThrowingValue(int value, bool fail)
+		:Value(value) {
+		if (fail)
+			throw ConstructionFailed();
+	}
+};
+
+static void test_throwing_constructor() {                                       // A failed emplace gives its node back, the queue stays usable and allocates nothing more
+	constexpr size_t Threshold = MPSCQueue<ThrowingValue>::RetireThreshold;
+
+	MPSCQueue<ThrowingValue> queue;
+	ThrowingValue value;
+	for (size_t i = 0; i < 2 * Threshold; i++) {
+		queue.emplace((int)i, false);
+		TEST_CHECK(queue.try_dequeue(value) && value.Value == (int)i);
+	}
+
+	size_t before = Allocations.load();
+	size_t thrown = 0;
+	for (size_t i = 0; i < 20 * Threshold; i++) {
+		try {
+			queue.emplace(-1, true);
+		}
+		catch (const ConstructionFailed&) {
+			thrown++;
+		}
+
+		queue.emplace((int)i, false);
+		TEST_CHECK(queue.try_dequeue(value) && value.Value == (int)i);
+	}
+	TEST_CHECK(thrown == 20 * Threshold);
+	TEST_CHECK(Allocations.load() - before <= Threshold);
+	TEST_CHECK(!queue.try_dequeue(value));
+}
+
+int main() {
+	test_producers_one_consumer();
+	test_pool_reuse();
+	test_values_destroyed();
+	test_move_only();
+	test_throwing_constructor();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "Queue/Queue.h"
+#include "TestCheck.h"
+
+struct Tracked                                                                  // Counts live instances, copy or move throws when armed
+{
+	static inline int Live = 0;
+	static inline int ThrowAfter = -1;                                          // Copies/moves left before one throws, -1 never
+
+	int Value = 0;
+
+	Tracked(int value) : Value(value) { Live++; }
+	Tracked(const Tracked& other) : Value(other.Value) { countdown(); Live++; }
+	Tracked(Tracked&& other) : Value(other.Value) { countdown(); Live++; }
+	Tracked& operator=(const Tracked& other) { countdown(); Value = other.Value; return *this; }
+	Tracked& operator=(Tracked&& other) { countdown(); Value = other.Value; return *this; }
+	~Tracked() { Live--; }
+
+	static void countdown() {
+		if (ThrowAfter == 0)
+			throw std::runtime_error("armed");
+		if (ThrowAfter > 0)
+			ThrowAfter--;
+	}
+};
+
+static void test_bulk_round_trip() {
+	Queue<int> queue;
+	std::vector<int> values = { 1, 2, 3, 4, 5 };
+	queue.enqueue(0);
+	queue.enqueue_bulk(values.begin(), values.end());
+	TEST_CHECK(queue.size() == 6);
+
+	DynamicArray<int> array;
+	TEST_CHECK(queue.dequeue_bulk(array, 4) == 4);
+	TEST_CHECK(array.size() == 4 && array[0] == 0 && array[3] == 3);
+
+	std::vector<int> rest;
+	TEST_CHECK(queue.dequeue_bulk(std::back_inserter(rest), 10) == 2);
+	TEST_CHECK(rest[0] == 4 && rest[1] == 5 && queue.empty());
+
+	queue.enqueue_bulk(values.begin(), values.end());
+	TEST_CHECK(queue.dequeue() == 1 && queue.size() == 4);
+}
+
+static void test_enqueue_bulk_throws() {                                       // Queue unchanged and no node leaked
+	std::vector<Tracked> values = { 1, 2, 3, 4 };
+	int liveBefore = Tracked::Live;
+	{
+		Queue<Tracked> queue;
+		queue.enqueue(Tracked(0));
+
+		Tracked::ThrowAfter = 2;
+		bool thrown = false;
+		try {
+			queue.enqueue_bulk(values.begin(), values.end());
+		}
+		catch (const std::runtime_error&) {
+			thrown = true;
+		}
+		Tracked::ThrowAfter = -1;
+
+		TEST_CHECK(thrown);
+		TEST_CHECK(queue.size() == 1 && queue.front().Value == 0);
+	}
+	TEST_CHECK(Tracked::Live == liveBefore);
+}
+
+static void test_dequeue_bulk_throws() {                                       // Components not moved out stay queued, in order
+	Queue<Tracked> queue;
+	for (int i = 0; i < 5; i++)
+		queue.enqueue(Tracked(i));
+
+	std::vector<Tracked> out;
+	out.reserve(5);
+	Tracked::ThrowAfter = 2;
+	bool thrown = false;
+	try {
+		queue.dequeue_bulk(std::back_inserter(out), 5);
+	}
+	catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	Tracked::ThrowAfter = -1;
+
+	TEST_CHECK(thrown);
+	TEST_CHECK(out.size() == 2);
+	TEST_CHECK(queue.size() == 3);
+	for (int i = 2; i < 5; i++)
+		TEST_CHECK(queue.dequeue().Value == i);
+	TEST_CHECK(queue.empty());
+}
+
+static void test_drain_in_small_batches() {                                    // Capacity grows geometrically, not once per batch
+	constexpr int Items = 100000;
+	Queue<int> queue;
+	for (int i = 0; i < Items; i++)
+		queue.enqueue(i);
+
+	DynamicArray<int> out;
+	size_t reallocations = 0;
+	const int* storage = out.data();
+	while (queue.dequeue_bulk(out, 16) > 0)
+		if (out.data() != storage) {
+			storage = out.data();
+			reallocations++;
+		}
+
+	TEST_CHECK(out.size() == (size_t)Items);
+	TEST_CHECK(reallocations < 40);
+	for (int i = 0; i < Items; i++)
+		TEST_CHECK(out[i] == i);
+}
+
+struct NoDefault                                                                // Move-only, not default constructible
+{
+	std::unique_ptr<int> Value;
+	explicit NoDefault(int value) : Value(new int(value)) { }
+};
+
+static void test_move_only_consumption() {
+	Queue<NoDefault> queue;
+	for (int i = 1; i <= 4; i++)
+		queue.enqueue(NoDefault(i));
+
+	TEST_CHECK(*queue.front().Value == 1);
+	TEST_CHECK(*queue.dequeue().Value == 1);
+	TEST_CHECK(*queue.pop()->Value == 2);
+
+	int seen = 0;
+	TEST_CHECK(queue.consume([&seen](NoDefault& value) { seen = *value.Value; }));
+	TEST_CHECK(seen == 3 && queue.size() == 1);
+
+	queue.pop();
+	TEST_CHECK(!queue.pop().has_value());
+
+	bool thrown = false;
+	try {
+		queue.dequeue();
+	}
+	catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	TEST_CHECK(thrown);
+}
+
+int main() {
+	test_bulk_round_trip();
+	test_enqueue_bulk_throws();
+	test_dequeue_bulk_throws();
+	test_drain_in_small_batches();
+	test_move_only_consumption();
+	return 0;
+}
\ No newline at end of file
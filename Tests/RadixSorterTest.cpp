@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include "RadixSorter/RadixSorter.h"
+#include "TestCheck.h"
+
+template<class Type, class Generator>
+static void check_against_std_sort(RadixSorter<Type>& sorter, const size_t& size, Generator&& generate) {
+	DynamicArray<Type> array;
+	array.reserve(size);
+	for (size_t i = 0; i < size; i++)
+		array.push_back(generate());
+
+	DynamicArray<Type> expected = array;
+	std::sort(expected.begin(), expected.end());
+	sorter.sort(array);
+
+	TEST_CHECK(array.size() == expected.size());
+	for (size_t i = 0; i < size; i++)
+		TEST_CHECK(array[i] == expected[i]);
+}
+
+static void test_key_kinds() {                                                 // Small (comparison) and radix paths for every key transform
+	std::mt19937_64 random(1);
+	RadixSorter<uint32_t> unsignedSorter;
+	RadixSorter<int64_t> signedSorter;
+	RadixSorter<double> doubleSorter;
+	RadixSorter<float> floatSorter;
+
+	for (size_t size : { 0, 1, 100, 5000, 100000 }) {
+		check_against_std_sort(unsignedSorter, size, [&]() { return (uint32_t)random(); });
+		check_against_std_sort(signedSorter, size, [&]() { return (int64_t)random(); });
+		check_against_std_sort(doubleSorter, size, [&]() { return std::uniform_real_distribution<double>(-1e9, 1e9)(random); });
+		check_against_std_sort(floatSorter, size, [&]() { return std::uniform_real_distribution<float>(-1e3f, 1e3f)(random); });
+	}
+
+	check_against_std_sort(unsignedSorter, 3000, [&]() { return (uint32_t)(random() % 4); });    // Passes where every digit matches are skipped
+}
+
+static void test_parallel_histograms() {                                        // Second sort reuses the per-thread histograms and scratch of the first
+	std::mt19937_64 random(2);
+	RadixSorter<int32_t> sorter(4);
+	check_against_std_sort(sorter, RadixSorter<int32_t>::ParallelSize + 123, [&]() { return (int32_t)random(); });
+	check_against_std_sort(sorter, RadixSorter<int32_t>::ParallelSize + 45, [&]() { return (int32_t)(random() % 1000); });
+}
+
+struct Record
+{
+	uint16_t Key;
+	uint32_t Order;
+};
+
+static void test_sort_by_key_is_stable() {
+	std::mt19937 random(3);
+	DynamicArray<Record> records;
+	for (uint32_t i = 0; i < 10000; i++)
+		records.push_back(Record{ (uint16_t)(random() % 50), i });
+
+	RadixSorter<Record> sorter;
+	sorter.sort_by_key(records, [](const Record& record) { return record.Key; });
+
+	for (size_t i = 1; i < records.size(); i++) {
+		TEST_CHECK(records[i - 1].Key <= records[i].Key);
+		if (records[i - 1].Key == records[i].Key)
+			TEST_CHECK(records[i - 1].Order < records[i].Order);
+	}
+}
+
+int main() {
+	test_key_kinds();
+	test_parallel_histograms();
+	test_sort_by_key_is_stable();
+	return 0;
+}
\ No newline at end of file
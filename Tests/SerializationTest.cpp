@@ -0,0 +1,251 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "Serialization/BinaryReader.h"
+#include "Serialization/BinaryWriter.h"
+#include "TestCheck.h"
+
+struct Point                                                                    // Trivially copyable, counts default constructions
+{
+	static inline int DefaultConstructed = 0;
+
+	int32_t X;
+	int32_t Y;
+
+	Point() : X(0), Y(0) { DefaultConstructed++; }
+	Point(int32_t x, int32_t y) : X(x), Y(y) { }
+};
+
+static void test_round_trip() {
+	DynamicArray<Point> points;
+	LinkedList<int64_t> list;
+	Queue<uint16_t> queue;
+	for (int i = 0; i < 3000; i++) {                                           // More than ChunkSize for the node-based containers
+		points.emplace_back(i, -i);
+		list.push_back(i * 3);
+		queue.enqueue((uint16_t)i);
+	}
+
+	DynamicArray<unsigned char> bytes;
+	MemorySink sink(bytes);
+	BinaryWriter<MemorySink> writer(sink);
+	writer.write(points);
+	writer.write(list);
+	writer.write(queue);
+
+	DynamicArray<Point> pointsIn;
+	pointsIn.emplace_back(7, 7);
+	LinkedList<int64_t> listIn;
+	Queue<uint16_t> queueIn;
+
+	MemorySource source(bytes.data(), bytes.size());
+	BinaryReader<MemorySource> reader(source);
+	int constructedBefore = Point::DefaultConstructed;
+	reader.read(pointsIn);
+	TEST_CHECK(Point::DefaultConstructed == constructedBefore);                // Storage is sized, not value-initialized
+	reader.read(listIn);
+	reader.read(queueIn);
+
+	TEST_CHECK(pointsIn.size() == points.size());
+	for (size_t i = 0; i < points.size(); i++)
+		TEST_CHECK(pointsIn[i].X == points[i].X && pointsIn[i].Y == points[i].Y);
+
+	TEST_CHECK(listIn.size() == list.size());
+	int64_t expected = 0;
+	for (int64_t value : listIn) {
+		TEST_CHECK(value == expected);
+		expected += 3;
+	}
+
+	TEST_CHECK(queueIn.size() == queue.size());
+	for (int i = 0; i < 3000; i++)
+		TEST_CHECK(queueIn.dequeue() == (uint16_t)i);
+}
+
+static void test_resize_for_overwrite() {                                      // Keeps existing values, grows capacity when needed
+	DynamicArray<int> array;
+	array.push_back(1);
+	array.push_back(2);
+	array.resize_for_overwrite(100);
+	TEST_CHECK(array.size() == 100 && array.capacity() >= 100);
+	TEST_CHECK(array[0] == 1 && array[1] == 2);
+
+	array.resize_for_overwrite(1);
+	TEST_CHECK(array.size() == 1 && array[0] == 1);
+}
+
+static void test_rejects_bad_input() {
+	DynamicArray<int32_t> values;
+	values.push_back(5);
+
+	DynamicArray<unsigned char> bytes;
+	MemorySink sink(bytes);
+	BinaryWriter<MemorySink> writer(sink);
+	writer.write(values);
+
+	bool thrown = false;                                                       // Element size differs
+	try {
+		DynamicArray<int64_t> wide;
+		MemorySource source(bytes.data(), bytes.size());
+		BinaryReader<MemorySource>(source).read(wide);
+	}
+	catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	TEST_CHECK(thrown);
+
+	thrown = false;                                                            // Truncated payload
+	DynamicArray<int32_t> truncated;
+	truncated.push_back(1);
+	try {
+		MemorySource source(bytes.data(), bytes.size() - 1);
+		BinaryReader<MemorySource>(source).read(truncated);
+	}
+	catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	TEST_CHECK(thrown);
+	TEST_CHECK(truncated.empty());
+}
+
+template<class Type>
+static bool read_throws(DynamicArray<unsigned char>& bytes, const uint64_t& forgedCount) {    // Patch the header count, expect runtime_error (not bad_alloc)
+	std::memcpy(bytes.data() + offsetof(BinaryHeader, Count), &forgedCount, sizeof(forgedCount));
+
+	DynamicArray<Type> array;
+	try {
+		MemorySource source(bytes.data(), bytes.size());
+		BinaryReader<MemorySource>(source).read(array);
+	}
+	catch (const std::runtime_error&) {
+		return array.empty();
+	}
+	return false;
+}
+
+static void test_forged_count() {                                              // Checked before anything is allocated
+	DynamicArray<int64_t> values;
+	for (int i = 0; i < 4; i++)
+		values.push_back(i);
+
+	DynamicArray<unsigned char> bytes;
+	MemorySink sink(bytes);
+	BinaryWriter<MemorySink>(sink).write(values);
+
+	TEST_CHECK(read_throws<int64_t>(bytes, uint64_t(1) << 40));
+	TEST_CHECK(read_throws<int64_t>(bytes, uint64_t(1) << 62));               // count * sizeof overflows
+}
+
+static void test_file_round_trip() {                                           // write/writev and read loops through a real descriptor
+	std::FILE* file = std::tmpfile();
+	TEST_CHECK(file != nullptr);
+	int fd = fileno(file);
+
+	DynamicArray<uint32_t> array;
+	LinkedList<double> list;
+	Queue<int16_t> queue;
+	for (int i = 0; i < 5000; i++) {
+		array.push_back((uint32_t)i * 7);
+		list.push_back(i * 0.5);
+		queue.enqueue((int16_t)-i);
+	}
+
+	FileDescriptorSink sink(fd);
+	BinaryWriter<FileDescriptorSink> writer(sink);
+	writer.write(array);
+	writer.write(list);
+	writer.write(queue);
+	TEST_CHECK(lseek(fd, 0, SEEK_SET) == 0);
+
+	DynamicArray<uint32_t> arrayIn;
+	LinkedList<double> listIn;
+	Queue<int16_t> queueIn;
+	FileDescriptorSource source(fd);
+	BinaryReader<FileDescriptorSource> reader(source);
+	reader.read(arrayIn);
+	reader.read(listIn);
+	reader.read(queueIn);
+
+	TEST_CHECK(arrayIn.size() == 5000 && listIn.size() == 5000 && queueIn.size() == 5000);
+	int i = 0;
+	for (double value : listIn) {
+		TEST_CHECK(arrayIn[i] == (uint32_t)i * 7 && value == i * 0.5 && queueIn.dequeue() == (int16_t)-i);
+		i++;
+	}
+
+	DynamicArray<uint32_t> extra;                                              // End of file
+	bool thrown = false;
+	try {
+		reader.read(extra);
+	}
+	catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	TEST_CHECK(thrown);
+	std::fclose(file);
+}
+
+static void test_pipe_gather() {                                               // More segments than one writev takes and more bytes than the pipe holds
+	int fds[2];
+	TEST_CHECK(pipe(fds) == 0);
+
+	constexpr size_t Segments = 3 * FileDescriptorSink::MaxSegments + 5;
+	constexpr size_t SegmentBytes = 4096;
+	std::vector<unsigned char> payload(Segments * SegmentBytes);
+	for (size_t i = 0; i < payload.size(); i++)
+		payload[i] = (unsigned char)(i * 31 + i / 4096);
+
+	std::vector<unsigned char> received(payload.size());
+	std::thread reader([&]() {
+		FileDescriptorSource source(fds[0]);
+		source.read(received.data(), received.size());
+	});
+
+	std::vector<BinarySegment> segments;
+	for (size_t i = 0; i < Segments; i++)
+		segments.push_back({ payload.data() + i * SegmentBytes, SegmentBytes });
+	FileDescriptorSink sink(fds[1]);
+	sink.write_gather(segments.data(), segments.size());
+
+	reader.join();
+	TEST_CHECK(received == payload);
+
+	DynamicArray<uint64_t> values;                                              // Forged count on a source of unknown length: fails at end of input, array left empty
+	values.push_back(1);
+	values.push_back(2);
+	DynamicArray<unsigned char> bytes;
+	MemorySink memory(bytes);
+	BinaryWriter<MemorySink>(memory).write(values);
+	uint64_t forgedCount = uint64_t(1) << 40;
+	std::memcpy(bytes.data() + offsetof(BinaryHeader, Count), &forgedCount, sizeof(forgedCount));
+
+	sink.write(bytes.data(), bytes.size());
+	close(fds[1]);
+
+	DynamicArray<uint64_t> array;
+	bool thrown = false;
+	try {
+		FileDescriptorSource source(fds[0]);
+		BinaryReader<FileDescriptorSource>(source).read(array);
+	}
+	catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	TEST_CHECK(thrown && array.empty());
+	close(fds[0]);
+}
+
+int main() {
+	test_round_trip();
+	test_resize_for_overwrite();
+	test_rejects_bad_input();
+	test_forged_count();
+	test_file_round_trip();
+	test_pipe_gather();
+	return 0;
+}
\ No newline at end of file
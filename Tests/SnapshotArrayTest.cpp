@@ -0,0 +1,122 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "SnapshotArray/SnapshotArray.h"
+#include "TestCheck.h"
+
+using Array = SnapshotArray<int>;
+constexpr size_t ChunkSize = Array::ChunkSize;
+
+static DynamicArray<int> iota(const size_t& size) {
+	DynamicArray<int> values;
+	for (size_t i = 0; i < size; i++)
+		values.push_back((int)i);
+	return values;
+}
+
+static void test_snapshot_unchanged_by_update() {
+	Array array(iota(10));
+	Array::Snapshot before = array.snapshot();
+
+	array.update([](Array::Version& version) {
+		version.set(3, 100);
+		version.push_back(10);
+	});
+
+	Array::Snapshot after = array.snapshot();
+	TEST_CHECK(before->size() == 10 && (*before)[3] == 3);
+	TEST_CHECK(after->size() == 11 && (*after)[3] == 100 && (*after)[10] == 10);
+}
+
+static void test_only_touched_chunk_is_cloned() {                              // Untouched chunks keep their storage, shared with the old version
+	Array array(iota(3 * ChunkSize));
+	Array::Snapshot before = array.snapshot();
+
+	array.update([](Array::Version& version) {
+		version.set(ChunkSize + 5, -1);
+	});
+	Array::Snapshot after = array.snapshot();
+
+	TEST_CHECK(&(*before)[0] == &(*after)[0]);
+	TEST_CHECK(&(*before)[ChunkSize] != &(*after)[ChunkSize]);
+	TEST_CHECK(&(*before)[2 * ChunkSize] == &(*after)[2 * ChunkSize]);
+	TEST_CHECK((*before)[ChunkSize + 5] == (int)ChunkSize + 5 && (*after)[ChunkSize + 5] == -1);
+
+	Array::Version owned(*after);                                              // A chunk made by this version is written in place
+	owned.push_back(1);
+	const int* last = &owned[owned.size() - 1];
+	owned.push_back(2);
+	TEST_CHECK(&owned[owned.size() - 2] == last);
+}
+
+static void test_pop_back_across_chunk_boundary() {
+	Array array(iota(ChunkSize + 1));
+	Array::Snapshot before = array.snapshot();
+	TEST_CHECK(before->chunk_count() == 2);
+
+	array.update([](Array::Version& version) {
+		version.pop_back();                                                    // Drops the second chunk
+		version.pop_back();                                                    // Clones the first chunk
+	});
+
+	Array::Snapshot after = array.snapshot();
+	TEST_CHECK(after->size() == ChunkSize - 1 && after->chunk_count() == 1);
+	TEST_CHECK(before->size() == ChunkSize + 1 && (*before)[ChunkSize] == (int)ChunkSize && (*before)[ChunkSize - 1] == (int)ChunkSize - 1);
+
+	array.update([](Array::Version& version) {
+		version.push_back(7);
+		version.push_back(8);
+	});
+	after = array.snapshot();
+	TEST_CHECK(after->size() == ChunkSize + 1 && (*after)[ChunkSize - 1] == 7 && (*after)[ChunkSize] == 8);
+}
+
+static void test_concurrent_updates() {                                        // Retries lose no update, readers never see a torn version
+	constexpr int Writers = 4;
+	constexpr int Updates = 300;
+	constexpr size_t Size = 2 * ChunkSize + 3;
+
+	Array array(DynamicArray<int>(Size, 0));
+	std::atomic<bool> done = false;
+	std::vector<std::thread> threads;
+
+	for (int r = 0; r < 2; r++)
+		threads.emplace_back([&]() {
+			int last = 0;
+			while (!done.load(std::memory_order_acquire)) {
+				Array::Snapshot snapshot = array.snapshot();
+				int first = (*snapshot)[0];
+				for (size_t i = 1; i < Size; i++)
+					TEST_CHECK((*snapshot)[i] == first);
+				TEST_CHECK(first >= last);
+				last = first;
+			}
+		});
+
+	for (int w = 0; w < Writers; w++)
+		threads.emplace_back([&array]() {
+			for (int u = 0; u < Updates; u++)
+				array.update([](Array::Version& version) {
+					for (size_t i = 0; i < version.size(); i++)
+						version.set(i, version[i] + 1);
+				});
+		});
+
+	for (int t = 2; t < 2 + Writers; t++)
+		threads[t].join();
+	done.store(true, std::memory_order_release);
+	threads[0].join();
+	threads[1].join();
+
+	Array::Snapshot result = array.snapshot();
+	for (size_t i = 0; i < Size; i++)
+		TEST_CHECK((*result)[i] == Writers * Updates);
+}
+
+int main() {
+	test_snapshot_unchanged_by_update();
+	test_only_touched_chunk_is_cloned();
+	test_pop_back_across_chunk_boundary();
+	test_concurrent_updates();
+	return 0;
+}
\ No newline at end of file
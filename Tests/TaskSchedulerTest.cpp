@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "TaskScheduler/TaskGroup.h"
+#include "TestCheck.h"
+
+static uint64_t fib(TaskScheduler& scheduler, const int& n) {
+	if (n < 2)
+		return n;
+
+	uint64_t left = 0;
+	TaskGroup group(scheduler);
+	group.spawn([&]() { left = fib(scheduler, n - 1); });
+	uint64_t right = fib(scheduler, n - 2);
+	group.wait();
+	return left + right;
+}
+
+static void quicksort(TaskScheduler& scheduler, int* first, int* last) {
+	if (last - first < 64) {
+		std::sort(first, last);
+		return;
+	}
+
+	int pivot = first[(last - first) / 2];
+	int* middle1 = std::partition(first, last, [pivot](int value) { return value < pivot; });
+	int* middle2 = std::partition(middle1, last, [pivot](int value) { return !(pivot < value); });
+
+	TaskGroup group(scheduler);
+	group.spawn([&]() { quicksort(scheduler, first, middle1); });
+	quicksort(scheduler, middle2, last);
+	group.wait();
+}
+
+static void test_fork_join() {
+	TaskScheduler scheduler(4);
+	TEST_CHECK(fib(scheduler, 20) == 6765);
+
+	std::vector<int> values(100000);
+	std::mt19937 random(1);
+	for (int& value : values)
+		value = (int)(random() % 1000);
+
+	std::vector<int> expected = values;
+	std::sort(expected.begin(), expected.end());
+	quicksort(scheduler, values.data(), values.data() + values.size());
+	TEST_CHECK(values == expected);
+}
+
+static void test_exception_reaches_wait() {                                    // Other tasks still finish, the first exception is rethrown once
+	TaskScheduler scheduler(4);
+	std::atomic<int> finished = 0;
+
+	TaskGroup group(scheduler);
+	for (int i = 0; i < 100; i++)
+		group.spawn([&finished, i]() {
+			if (i % 10 == 0)
+				throw std::runtime_error("task failed");
+			finished.fetch_add(1);
+		});
+
+	bool thrown = false;
+	try {
+		group.wait();
+	}
+	catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	TEST_CHECK(thrown);
+	TEST_CHECK(finished.load() == 90);
+
+	group.spawn([&finished]() { finished.fetch_add(1); });                     // Group is usable again
+	group.wait();
+	TEST_CHECK(finished.load() == 91);
+
+	{
+		TaskGroup dropped(scheduler);                                          // Destructor joins without throwing
+		dropped.spawn([]() { throw std::runtime_error("ignored"); });
+	}
+}
+
+static void test_deque_steal() {                                               // Owner push/pop against thieves, every value taken exactly once
+	constexpr size_t Items = 200000;
+	constexpr size_t Thieves = 3;
+
+	WorkStealingDeque<size_t> deque(4);
+	std::vector<std::atomic<int>> taken(Items);
+	std::atomic<bool> done = false;
+	std::vector<std::thread> thieves;
+
+	for (size_t t = 0; t < Thieves; t++)
+		thieves.emplace_back([&]() {
+			size_t value;
+			while (!done.load(std::memory_order_acquire))
+				if (deque.steal(value))
+					taken[value].fetch_add(1, std::memory_order_relaxed);
+				else
+					std::this_thread::yield();
+		});
+
+	size_t value;
+	for (size_t i = 0; i < Items; i++) {
+		deque.push(i);
+		if (i % 3 == 0 && deque.pop(value))
+			taken[value].fetch_add(1, std::memory_order_relaxed);
+	}
+	while (deque.pop(value))
+		taken[value].fetch_add(1, std::memory_order_relaxed);
+
+	while (!deque.empty())
+		std::this_thread::yield();
+	done.store(true, std::memory_order_release);
+	for (std::thread& thief : thieves)
+		thief.join();
+
+	for (size_t i = 0; i < Items; i++)
+		TEST_CHECK(taken[i].load() == 1);
+}
+
+int main() {
+	test_fork_join();
+	test_exception_reaches_wait();
+	test_deque_steal();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+#include <cstdio>
+#include <cstdlib>
+
+inline void test_check(const bool& condition, const char* expression, const char* file, const int& line) {    // Report failed check and end the test with a non-zero code
+	if (condition)
+		return;
+
+	std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+	std::exit(1);
+}
+
+#define TEST_CHECK(condition) test_check((condition), #condition, __FILE__, __LINE__)
\ No newline at end of file
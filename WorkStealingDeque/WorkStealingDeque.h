@@ -0,0 +1,114 @@
+#pragma once
+#include <atomic>
+#include <type_traits>
+#include "WorkStealingDequeBuffer.h"
+#include "../DynamicArray/DynamicArray.h"
+
+template<class Type>
+class WorkStealingDeque                                                         // Chase-Lev deque: the owner pushes/pops at the bottom, thieves steal from the top
+{
+public:
+	using ValueType = Type;                                                     // Type for stored values (small and trivially copyable, e.g. task pointers)
+	using Buffer = WorkStealingDequeBuffer<WorkStealingDeque<ValueType>>;             // Circular array type
+
+	static_assert(std::is_trivially_copyable_v<ValueType>, "WorkStealingDeque values must be trivially copyable");
+
+private:
+	alignas(64) std::atomic<ptrdiff_t> _top = 0;                                // Next position to steal (thieves and owner)
+	alignas(64) std::atomic<ptrdiff_t> _bottom = 0;                             // Next position to push (owner only writes)
+	std::atomic<Buffer*> _buffer = nullptr;                                     // Current circular array
+	DynamicArray<Buffer*> _retired;                                             // Outgrown arrays, kept alive while thieves may still read them
+
+public:
+	// Constructors
+
+	WorkStealingDeque(const size_t& capacity = 64) {                            // Capacity is rounded up to a power of 2 (minimum 2)
+		size_t newCapacity = 2;
+		while (newCapacity < capacity)
+			newCapacity <<= 1;
+
+		_buffer.store(new Buffer(newCapacity), std::memory_order_relaxed);
+	}
+
+	WorkStealingDeque(const WorkStealingDeque&) = delete;
+	WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+	~WorkStealingDeque() {                                                      // Destructor
+		delete _buffer.load(std::memory_order_relaxed);
+		for (Buffer* buffer : _retired)
+			delete buffer;
+	}
+
+public:
+	// Main functions (owner thread only)
+
+	void push(const ValueType& value) {                                         // Add value to the bottom, growing the array when full
+		ptrdiff_t bottom = _bottom.load(std::memory_order_relaxed);
+		ptrdiff_t top = _top.load(std::memory_order_acquire);
+		Buffer* buffer = _buffer.load(std::memory_order_relaxed);
+
+		if (bottom - top > (ptrdiff_t)buffer->capacity() - 1) {
+			_retired.push_back(buffer);
+			buffer = buffer->grow(bottom, top);
+			_buffer.store(buffer, std::memory_order_release);
+		}
+
+		buffer->store(bottom, value);
+		_bottom.store(bottom + 1, std::memory_order_release);                  // Publishes value (and what it points to) to thieves
+	}
+
+	bool pop(ValueType& out) {                                                  // Take value from the bottom, false when empty or lost to a thief
+		ptrdiff_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+		Buffer* buffer = _buffer.load(std::memory_order_relaxed);
+		_bottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		ptrdiff_t top = _top.load(std::memory_order_relaxed);
+
+		if (top > bottom) {                                                     // Empty
+			_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		out = buffer->load(bottom);
+		if (top == bottom) {                                                    // Last value, race thieves for it
+			bool won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return won;
+		}
+		return true;
+	}
+
+public:
+	// Main functions (any thread)
+
+	bool steal(ValueType& out) {                                                // Take value from the top, false when empty or lost to another thread
+		ptrdiff_t top = _top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		ptrdiff_t bottom = _bottom.load(std::memory_order_acquire);
+
+		if (top >= bottom)
+			return false;
+
+		Buffer* buffer = _buffer.load(std::memory_order_acquire);
+		ValueType value = buffer->load(top);
+		if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return false;
+
+		out = value;
+		return true;
+	}
+
+	const size_t size() const {                                                 // Get size (approximate while other threads operate)
+		ptrdiff_t bottom = _bottom.load(std::memory_order_relaxed);
+		ptrdiff_t top = _top.load(std::memory_order_relaxed);
+		return bottom > top ? (size_t)(bottom - top) : 0;
+	}
+
+	bool empty() const {                                                        // Check if deque is empty (approximate while other threads operate)
+		return size() == 0;
+	}
+
+	const size_t capacity() const {                                             // Get capacity of the current array
+		return _buffer.load(std::memory_order_relaxed)->capacity();
+	}
+};
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+#include <atomic>
+
+template<class WorkStealingDeque>
+class WorkStealingDequeBuffer                                                   // Circular array of atomic slots indexed by unbounded positions
+{
+public:
+	using ValueType = typename WorkStealingDeque::ValueType;
+
+private:
+	size_t _capacity = 0;                                                       // Number of slots (power of 2)
+	size_t _mask = 0;                                                           // _capacity - 1, used to wrap positions
+	std::atomic<ValueType>* _array = nullptr;                                   // Actual slots
+
+public:
+	// Constructors
+
+	WorkStealingDequeBuffer(const size_t& newCapacity)
+		:_capacity(newCapacity), _mask(newCapacity - 1) {
+		_array = new std::atomic<ValueType>[_capacity];
+	}
+
+	WorkStealingDequeBuffer(const WorkStealingDequeBuffer&) = delete;
+	WorkStealingDequeBuffer& operator=(const WorkStealingDequeBuffer&) = delete;
+
+	~WorkStealingDequeBuffer() {
+		delete[] _array;
+	}
+
+public:
+	// Main functions
+
+	const size_t capacity() const {                                             // Get capacity
+		return _capacity;
+	}
+
+	ValueType load(const ptrdiff_t& position) const {                           // Read slot at position (may race with the owner, hence atomic)
+		return _array[position & _mask].load(std::memory_order_relaxed);
+	}
+
+	void store(const ptrdiff_t& position, const ValueType& value) {             // Write slot at position
+		_array[position & _mask].store(value, std::memory_order_relaxed);
+	}
+
+	WorkStealingDequeBuffer* grow(const ptrdiff_t& bottom, const ptrdiff_t& top) const {    // Copy live range [top, bottom) into a buffer of double capacity
+		WorkStealingDequeBuffer* newBuffer = new WorkStealingDequeBuffer(_capacity * 2);
+		for (ptrdiff_t i = top; i < bottom; i++)
+			newBuffer->store(i, load(i));
+
+		return newBuffer;
+	}
+};
\ No newline at end of file